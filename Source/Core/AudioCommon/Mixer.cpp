@@ -4,13 +4,21 @@
 #include "AudioCommon/Mixer.h"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstring>
 
+#if defined(_M_X86_64)
+#include <emmintrin.h>
+#elif defined(_M_ARM_64)
+#include <arm_neon.h>
+#endif
+
 #include "AudioCommon/Enums.h"
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
+#include "Common/MathUtil.h"
 #include "Common/Swap.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
@@ -31,6 +39,49 @@ static u32 DPL2QualityToFrameBlockSize(AudioCommon::DPL2Quality quality)
   }
 }
 
+// Applies a resampling filter to a window of interleaved stereo samples. The filter has every
+// coefficient stored twice, so the even lanes accumulate the left channel and the odd lanes the
+// right one. SSE2 and NEON are always available on the respective architectures.
+template <u32 size>
+static std::array<float, 2> ApplyResamplerFilter(const float* filter, const float* window)
+{
+  static_assert(size % 8 == 0);
+#if defined(_M_X86_64)
+  __m128 sums_a = _mm_setzero_ps();
+  __m128 sums_b = _mm_setzero_ps();
+  for (u32 i = 0; i < size; i += 8)
+  {
+    sums_a = _mm_add_ps(sums_a, _mm_mul_ps(_mm_loadu_ps(filter + i), _mm_loadu_ps(window + i)));
+    sums_b = _mm_add_ps(sums_b,
+                        _mm_mul_ps(_mm_loadu_ps(filter + i + 4), _mm_loadu_ps(window + i + 4)));
+  }
+  const __m128 sums = _mm_add_ps(sums_a, sums_b);
+  const __m128 pair = _mm_add_ps(sums, _mm_movehl_ps(sums, sums));
+  alignas(16) std::array<float, 4> result;
+  _mm_store_ps(result.data(), pair);
+  return {result[0], result[1]};
+#elif defined(_M_ARM_64)
+  float32x4_t sums_a = vdupq_n_f32(0.0f);
+  float32x4_t sums_b = vdupq_n_f32(0.0f);
+  for (u32 i = 0; i < size; i += 8)
+  {
+    sums_a = vfmaq_f32(sums_a, vld1q_f32(filter + i), vld1q_f32(window + i));
+    sums_b = vfmaq_f32(sums_b, vld1q_f32(filter + i + 4), vld1q_f32(window + i + 4));
+  }
+  const float32x4_t sums = vaddq_f32(sums_a, sums_b);
+  const float32x2_t pair = vadd_f32(vget_low_f32(sums), vget_high_f32(sums));
+  return {vget_lane_f32(pair, 0), vget_lane_f32(pair, 1)};
+#else
+  std::array<float, 2> sums{};
+  for (u32 i = 0; i < size; i += 2)
+  {
+    sums[0] += filter[i] * window[i];
+    sums[1] += filter[i + 1] * window[i + 1];
+  }
+  return sums;
+#endif
+}
+
 Mixer::Mixer(unsigned int BackendSampleRate)
     : m_sampleRate(BackendSampleRate), m_stretcher(BackendSampleRate),
       m_surround_decoder(BackendSampleRate,
@@ -100,6 +151,23 @@ unsigned int Mixer::MixerFifo::Mix(short* samples, unsigned int numSamples,
 
   const u32 ratio = (u32)(65536.0f * aid_sample_rate / (float)m_mixer->m_sampleRate);
 
+  // Pick up filters rebuilt by UpdateFilterBank. Swapping the vectors neither allocates nor frees
+  // memory, and if UpdateFilterBank holds the lock right now, the old filters are used once more.
+  if (m_filter_bank_pending.load())
+  {
+    std::unique_lock lock(m_filter_bank_lock, std::defer_lock);
+    if (m_filter_bank.empty())
+      lock.lock();
+    else
+      lock.try_lock();
+
+    if (lock.owns_lock())
+    {
+      std::swap(m_filter_bank, m_pending_filter_bank);
+      m_filter_bank_pending.store(false);
+    }
+  }
+
   s32 lvolume = m_LVolume.load();
   s32 rvolume = m_RVolume.load();
 
@@ -107,29 +175,42 @@ unsigned int Mixer::MixerFifo::Mix(short* samples, unsigned int numSamples,
     return m_little_endian ? m_buffer[index] : Common::swap16(m_buffer[index]);
   };
 
-  // TODO: consider a higher-quality resampling algorithm.
-  for (; currentSample < numSamples * 2 && ((indexW - indexR) & INDEX_MASK) > 2; currentSample += 2)
+  // Convert the input once up front, along with the history the filters need before indexR
+  const u32 available = ((indexW - indexR) & INDEX_MASK) / 2;
+  float* const input = m_mixer->m_resampler_input.data();
+  if (available > RESAMPLER_LOOKAHEAD)
   {
-    u32 indexR2 = indexR + 2;  // next sample
+    const u32 start = indexR - RESAMPLER_HISTORY * 2;
+    for (u32 i = 0; i < (RESAMPLER_HISTORY + available) * 2; ++i)
+      input[i] = read_buffer((start + i) & INDEX_MASK);
+  }
+
+  constexpr u32 FRAC_PER_PHASE = 0x10000 / RESAMPLER_PHASES;
+  u32 position = 0;
+  for (; currentSample < numSamples * 2 && position + RESAMPLER_LOOKAHEAD < available;
+       currentSample += 2)
+  {
+    // Use the filter of the nearest phase. Rounding up to RESAMPLER_PHASES is fine, since the
+    // bank has a filter for the position one full input sample ahead as well.
+    const u32 phase = (m_frac + FRAC_PER_PHASE / 2) / FRAC_PER_PHASE;
+    const std::array<float, 2> sums = ApplyResamplerFilter<RESAMPLER_TAPS * 2>(
+        &m_filter_bank[phase * RESAMPLER_TAPS * 2], input + position * 2);
 
-    s16 l1 = read_buffer(indexR & INDEX_MASK);   // current
-    s16 l2 = read_buffer(indexR2 & INDEX_MASK);  // next
-    int sampleL = ((l1 << 16) + (l2 - l1) * (u16)m_frac) >> 16;
+    int sampleL = static_cast<int>(sums[0]);
     sampleL = (sampleL * lvolume) >> 8;
     sampleL += samples[currentSample + 1];
     samples[currentSample + 1] = std::clamp(sampleL, -32767, 32767);
 
-    s16 r1 = read_buffer((indexR + 1) & INDEX_MASK);   // current
-    s16 r2 = read_buffer((indexR2 + 1) & INDEX_MASK);  // next
-    int sampleR = ((r1 << 16) + (r2 - r1) * (u16)m_frac) >> 16;
+    int sampleR = static_cast<int>(sums[1]);
     sampleR = (sampleR * rvolume) >> 8;
     sampleR += samples[currentSample];
     samples[currentSample] = std::clamp(sampleR, -32767, 32767);
 
     m_frac += ratio;
-    indexR += 2 * (u16)(m_frac >> 16);
+    position += m_frac >> 16;
     m_frac &= 0xffff;
   }
+  indexR += position * 2;
 
   // Actual number of samples written to the buffer without padding.
   unsigned int actual_sample_count = currentSample / 2;
@@ -155,6 +236,60 @@ unsigned int Mixer::MixerFifo::Mix(short* samples, unsigned int numSamples,
   return actual_sample_count;
 }
 
+void Mixer::MixerFifo::UpdateFilterBank()
+{
+  // Filter out everything above the lower of the two Nyquist frequencies. The cutoff is based on
+  // the nominal rates so that the small adjustments made by Mix() don't need new filters.
+  float nominal_ratio = static_cast<float>(FIXED_SAMPLE_RATE_DIVIDEND) /
+                        (static_cast<float>(m_input_sample_rate_divisor) * m_mixer->m_sampleRate);
+  const float emulation_speed = m_mixer->m_config_emulation_speed;
+  if (!m_mixer->m_config_audio_stretch && emulation_speed > 0.0f)
+    nominal_ratio *= emulation_speed;
+  const float cutoff = std::round(std::min(1.0f, 1.0f / nominal_ratio) * 0.9f * 64.0f) / 64.0f;
+
+  std::lock_guard lock(m_filter_bank_lock);
+  if (cutoff == m_filter_cutoff)
+    return;
+
+  m_pending_filter_bank = BuildFilterBank(cutoff);
+  m_filter_cutoff = cutoff;
+  m_filter_bank_pending.store(true);
+}
+
+std::vector<float> Mixer::MixerFifo::BuildFilterBank(float cutoff)
+{
+  // Blackman-windowed sinc filters. Tap i of phase p is applied to the input sample at
+  // i - RESAMPLER_HISTORY relative to indexR, when the output is p / RESAMPLER_PHASES past indexR.
+  constexpr float HALF_WIDTH = RESAMPLER_TAPS / 2;
+  std::vector<float> filter_bank((RESAMPLER_PHASES + 1) * RESAMPLER_TAPS * 2);
+  for (u32 phase = 0; phase <= RESAMPLER_PHASES; ++phase)
+  {
+    float* filter = &filter_bank[phase * RESAMPLER_TAPS * 2];
+    const float offset = static_cast<float>(phase) / RESAMPLER_PHASES;
+
+    float sum = 0.0f;
+    for (u32 i = 0; i < RESAMPLER_TAPS; ++i)
+    {
+      const float x = static_cast<float>(i) - RESAMPLER_HISTORY - offset;
+      const float window = 0.42f + 0.5f * std::cos(MathUtil::PI * x / HALF_WIDTH) +
+                           0.08f * std::cos(2.0f * MathUtil::PI * x / HALF_WIDTH);
+      const float y = MathUtil::PI * cutoff * x;
+      const float sinc = y == 0.0f ? 1.0f : std::sin(y) / y;
+      filter[i * 2] = std::max(window, 0.0f) * sinc;
+      sum += filter[i * 2];
+    }
+
+    // Normalize the gain so that constant signals come out unchanged
+    for (u32 i = 0; i < RESAMPLER_TAPS; ++i)
+    {
+      filter[i * 2] /= sum;
+      filter[i * 2 + 1] = filter[i * 2];
+    }
+  }
+
+  return filter_bank;
+}
+
 unsigned int Mixer::Mix(short* samples, unsigned int num_samples)
 {
   if (!samples)
@@ -251,9 +386,13 @@ void Mixer::MixerFifo::PushSamples(const short* samples, unsigned int num_sample
   u32 indexW = m_indexW.load();
 
   // Check if we have enough free space
-  // indexW == m_indexR results in empty buffer, so indexR must always be smaller than indexW
-  if (num_samples * 2 + ((indexW - m_indexR.load()) & INDEX_MASK) >= MAX_SAMPLES * 2)
+  // indexW == m_indexR results in empty buffer, so indexR must always be smaller than indexW.
+  // The samples right before indexR are still needed by the resampler and mustn't be overwritten.
+  if ((num_samples + RESAMPLER_HISTORY) * 2 + ((indexW - m_indexR.load()) & INDEX_MASK) >=
+      MAX_SAMPLES * 2)
+  {
     return;
+  }
 
   // AyuanX: Actual re-sampling work has been moved to sound thread
   // to alleviate the workload on main thread
@@ -458,6 +597,14 @@ void Mixer::RefreshConfig()
   m_config_emulation_speed = Config::Get(Config::MAIN_EMULATION_SPEED);
   m_config_timing_variance = Config::Get(Config::MAIN_TIMING_VARIANCE);
   m_config_audio_stretch = Config::Get(Config::MAIN_AUDIO_STRETCH);
+
+  // The emulation speed and audio stretching affect the cutoff of the resampling filters
+  m_dma_mixer.UpdateFilterBank();
+  m_streaming_mixer.UpdateFilterBank();
+  m_wiimote_speaker_mixer.UpdateFilterBank();
+  m_skylander_portal_mixer.UpdateFilterBank();
+  for (auto& mixer : m_gba_mixers)
+    mixer.UpdateFilterBank();
 }
 
 void Mixer::MixerFifo::DoState(PointerWrap& p)
@@ -465,11 +612,18 @@ void Mixer::MixerFifo::DoState(PointerWrap& p)
   p.Do(m_input_sample_rate_divisor);
   p.Do(m_LVolume);
   p.Do(m_RVolume);
+
+  if (p.IsReadMode())
+    UpdateFilterBank();
 }
 
 void Mixer::MixerFifo::SetInputSampleRateDivisor(unsigned int rate_divisor)
 {
+  if (rate_divisor == m_input_sample_rate_divisor)
+    return;
+
   m_input_sample_rate_divisor = rate_divisor;
+  UpdateFilterBank();
 }
 
 unsigned int Mixer::MixerFifo::GetInputSampleRateDivisor() const
@@ -491,8 +645,8 @@ std::pair<s32, s32> Mixer::MixerFifo::GetVolume() const
 unsigned int Mixer::MixerFifo::AvailableSamples() const
 {
   unsigned int samples_in_fifo = ((m_indexW.load() - m_indexR.load()) & INDEX_MASK) / 2;
-  if (samples_in_fifo <= 1)
-    return 0;  // Mixer::MixerFifo::Mix always keeps one sample in the buffer.
-  return (samples_in_fifo - 1) * static_cast<u64>(m_mixer->m_sampleRate) *
+  if (samples_in_fifo <= RESAMPLER_LOOKAHEAD)
+    return 0;  // Mixer::MixerFifo::Mix needs RESAMPLER_LOOKAHEAD samples after the current one.
+  return (samples_in_fifo - RESAMPLER_LOOKAHEAD) * static_cast<u64>(m_mixer->m_sampleRate) *
          m_input_sample_rate_divisor / FIXED_SAMPLE_RATE_DIVIDEND;
 }
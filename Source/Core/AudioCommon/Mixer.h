@@ -5,6 +5,8 @@
 
 #include <array>
 #include <atomic>
+#include <mutex>
+#include <vector>
 
 #include "AudioCommon/AudioStretcher.h"
 #include "AudioCommon/SurroundDecoder.h"
@@ -60,6 +62,15 @@ private:
   static constexpr float CONTROL_FACTOR = 0.2f;
   static constexpr u32 CONTROL_AVG = 32;  // In freq_shift per FIFO size offset
 
+  // Every output sample is interpolated from RESAMPLER_TAPS input samples with a windowed sinc
+  // filter. RESAMPLER_PHASES filters are precomputed for evenly spaced fractional positions,
+  // and the nearest one is used.
+  static constexpr u32 RESAMPLER_TAPS = 16;
+  static constexpr u32 RESAMPLER_PHASES = 512;
+  // Input samples that have to be kept around before and after the current read position
+  static constexpr u32 RESAMPLER_HISTORY = RESAMPLER_TAPS / 2 - 1;
+  static constexpr u32 RESAMPLER_LOOKAHEAD = RESAMPLER_TAPS / 2;
+
   const unsigned int SURROUND_CHANNELS = 6;
 
   class MixerFifo final
@@ -79,8 +90,13 @@ private:
     void SetVolume(unsigned int lvolume, unsigned int rvolume);
     std::pair<s32, s32> GetVolume() const;
     unsigned int AvailableSamples() const;
+    // Rebuilds the resampling filters if the input rate, output rate or emulation speed changed
+    // their cutoff. Never called on the audio thread, which picks the new filters up in Mix().
+    void UpdateFilterBank();
 
   private:
+    static std::vector<float> BuildFilterBank(float cutoff);
+
     Mixer* m_mixer;
     unsigned m_input_sample_rate_divisor;
     bool m_little_endian;
@@ -92,6 +108,17 @@ private:
     std::atomic<s32> m_RVolume{256};
     float m_numLeftI = 0.0f;
     u32 m_frac = 0;
+    // RESAMPLER_PHASES + 1 filters, with every coefficient stored twice so that both channels
+    // of an interleaved stereo sample can be processed at once. Only used by the audio thread.
+    std::vector<float> m_filter_bank;
+    // Filters built by UpdateFilterBank, which Mix() swaps with m_filter_bank. The old filters
+    // are left here, so that they're freed by the next UpdateFilterBank rather than on the audio
+    // thread.
+    std::vector<float> m_pending_filter_bank;
+    std::atomic<bool> m_filter_bank_pending{false};
+    // Guards m_pending_filter_bank and m_filter_cutoff. Mix() only ever tries to lock it.
+    std::mutex m_filter_bank_lock;
+    float m_filter_cutoff = 0.0f;
   };
 
   void RefreshConfig();
@@ -110,6 +137,9 @@ private:
   AudioCommon::AudioStretcher m_stretcher;
   AudioCommon::SurroundDecoder m_surround_decoder;
   std::array<short, MAX_SAMPLES * 2> m_scratch_buffer{};
+  // Input of MixerFifo::Mix converted to floats, shared by all FIFOs since they're mixed one
+  // after another
+  std::array<float, (MAX_SAMPLES + RESAMPLER_HISTORY) * 2> m_resampler_input{};
 
   WaveFileWriter m_wave_writer_dtk;
   WaveFileWriter m_wave_writer_dsp;
@@ -0,0 +1,278 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Common/BinaryDelta.h"
+
+#include <cstring>
+#include <type_traits>
+#include <unordered_map>
+
+namespace Common
+{
+namespace
+{
+constexpr u32 DELTA_MAGIC = 0x41544C44;  // "DLTA"
+
+// Matches are searched for at this granularity. It's the page size on most hosts, which makes
+// a page of emulated memory that was written to cost roughly one page in the delta.
+constexpr size_t BLOCK_SIZE = 4096;
+
+constexpr u32 HASH_MULTIPLIER = 0x01000193;
+
+// Used to skip most hash table lookups while scanning through data that doesn't match anything.
+constexpr size_t HASH_FILTER_BITS = 20;
+
+enum class DeltaOp : u8
+{
+  Copy = 0,
+  Literal = 1,
+};
+
+struct DeltaHeader
+{
+  u32 magic;
+  u32 reserved;
+  u64 base_size;
+  u64 target_size;
+};
+static_assert(std::is_trivially_copyable_v<DeltaHeader>);
+
+constexpr u32 GetHashRemovalFactor()
+{
+  u32 factor = 1;
+  for (size_t i = 0; i < BLOCK_SIZE; ++i)
+    factor *= HASH_MULTIPLIER;
+  return factor;
+}
+
+u32 HashBlock(const u8* data)
+{
+  u32 hash = 0;
+  for (size_t i = 0; i < BLOCK_SIZE; ++i)
+    hash = hash * HASH_MULTIPLIER + data[i];
+  return hash;
+}
+
+u32 RollHash(u32 hash, u8 removed, u8 added)
+{
+  static constexpr u32 removal_factor = GetHashRemovalFactor();
+  return hash * HASH_MULTIPLIER - removed * removal_factor + added;
+}
+
+class DeltaWriter
+{
+public:
+  explicit DeltaWriter(std::vector<u8>* out) : m_out(out) {}
+
+  void Copy(u64 base_offset, u64 length)
+  {
+    FlushLiteral();
+    if (m_copy_length != 0 && m_copy_offset + m_copy_length == base_offset)
+    {
+      m_copy_length += length;
+      return;
+    }
+
+    FlushCopy();
+    m_copy_offset = base_offset;
+    m_copy_length = length;
+  }
+
+  void Literal(const u8* data, u64 length)
+  {
+    FlushCopy();
+    if (m_literal_length == 0)
+      m_literal_data = data;
+    m_literal_length += length;
+  }
+
+  void Flush()
+  {
+    FlushCopy();
+    FlushLiteral();
+  }
+
+private:
+  template <typename T>
+  void Append(const T& value)
+  {
+    const u8* ptr = reinterpret_cast<const u8*>(&value);
+    m_out->insert(m_out->end(), ptr, ptr + sizeof(T));
+  }
+
+  void FlushCopy()
+  {
+    if (m_copy_length == 0)
+      return;
+
+    Append(DeltaOp::Copy);
+    Append(m_copy_offset);
+    Append(m_copy_length);
+    m_copy_length = 0;
+  }
+
+  void FlushLiteral()
+  {
+    if (m_literal_length == 0)
+      return;
+
+    Append(DeltaOp::Literal);
+    Append(m_literal_length);
+    m_out->insert(m_out->end(), m_literal_data, m_literal_data + m_literal_length);
+    m_literal_length = 0;
+  }
+
+  std::vector<u8>* m_out;
+  u64 m_copy_offset = 0;
+  u64 m_copy_length = 0;
+  const u8* m_literal_data = nullptr;
+  u64 m_literal_length = 0;
+};
+}  // namespace
+
+std::vector<u8> CreateBinaryDelta(std::span<const u8> base, std::span<const u8> target)
+{
+  std::vector<u8> delta(sizeof(DeltaHeader));
+  const DeltaHeader header{DELTA_MAGIC, 0, base.size(), target.size()};
+  std::memcpy(delta.data(), &header, sizeof(header));
+
+  // Index every aligned block of the base so that data which moved can be found again
+  std::unordered_map<u32, u64> block_index;
+  std::vector<u64> hash_filter((size_t(1) << HASH_FILTER_BITS) / 64);
+  block_index.reserve(base.size() / BLOCK_SIZE);
+  for (u64 offset = 0; offset + BLOCK_SIZE <= base.size(); offset += BLOCK_SIZE)
+  {
+    const u32 hash = HashBlock(base.data() + offset);
+    block_index.try_emplace(hash, offset);
+    const u32 filter_bit = hash & ((1 << HASH_FILTER_BITS) - 1);
+    hash_filter[filter_bit / 64] |= u64(1) << (filter_bit % 64);
+  }
+
+  DeltaWriter writer(&delta);
+
+  // Where the next target byte is expected to be in the base if nothing has changed
+  u64 expected_offset = 0;
+  u64 offset = 0;
+
+  u32 hash = 0;
+  bool hash_valid = false;
+
+  while (offset + BLOCK_SIZE <= target.size())
+  {
+    const u8* current = target.data() + offset;
+
+    // Fast path for unchanged data
+    if (!hash_valid && expected_offset + BLOCK_SIZE <= base.size() &&
+        std::memcmp(current, base.data() + expected_offset, BLOCK_SIZE) == 0)
+    {
+      writer.Copy(expected_offset, BLOCK_SIZE);
+      offset += BLOCK_SIZE;
+      expected_offset += BLOCK_SIZE;
+      continue;
+    }
+
+    if (!hash_valid)
+    {
+      hash = HashBlock(current);
+      hash_valid = true;
+    }
+
+    const u32 filter_bit = hash & ((1 << HASH_FILTER_BITS) - 1);
+    if (hash_filter[filter_bit / 64] & (u64(1) << (filter_bit % 64)))
+    {
+      const auto it = block_index.find(hash);
+      if (it != block_index.end() &&
+          std::memcmp(current, base.data() + it->second, BLOCK_SIZE) == 0)
+      {
+        writer.Copy(it->second, BLOCK_SIZE);
+        offset += BLOCK_SIZE;
+        expected_offset = it->second + BLOCK_SIZE;
+        hash_valid = false;
+        continue;
+      }
+    }
+
+    writer.Literal(current, 1);
+    if (offset + BLOCK_SIZE < target.size())
+      hash = RollHash(hash, current[0], current[BLOCK_SIZE]);
+    ++offset;
+    ++expected_offset;
+  }
+
+  const u64 remaining = target.size() - offset;
+  if (remaining != 0)
+  {
+    if (expected_offset + remaining <= base.size() &&
+        std::memcmp(target.data() + offset, base.data() + expected_offset, remaining) == 0)
+    {
+      writer.Copy(expected_offset, remaining);
+    }
+    else
+    {
+      writer.Literal(target.data() + offset, remaining);
+    }
+  }
+
+  writer.Flush();
+  return delta;
+}
+
+std::optional<std::vector<u8>> ApplyBinaryDelta(std::span<const u8> base,
+                                                std::span<const u8> delta)
+{
+  size_t position = 0;
+  const auto read = [&](auto* value) {
+    if (delta.size() - position < sizeof(*value))
+      return false;
+    std::memcpy(value, delta.data() + position, sizeof(*value));
+    position += sizeof(*value);
+    return true;
+  };
+
+  DeltaHeader header;
+  if (!read(&header) || header.magic != DELTA_MAGIC || header.base_size != base.size())
+    return std::nullopt;
+
+  std::vector<u8> target;
+  target.reserve(header.target_size);
+
+  while (position < delta.size())
+  {
+    DeltaOp op;
+    if (!read(&op))
+      return std::nullopt;
+
+    if (op == DeltaOp::Copy)
+    {
+      u64 base_offset, length;
+      if (!read(&base_offset) || !read(&length) || base_offset > base.size() ||
+          length > base.size() - base_offset || length > header.target_size - target.size())
+      {
+        return std::nullopt;
+      }
+      target.insert(target.end(), base.begin() + base_offset,
+                    base.begin() + base_offset + length);
+    }
+    else if (op == DeltaOp::Literal)
+    {
+      u64 length;
+      if (!read(&length) || length > delta.size() - position ||
+          length > header.target_size - target.size())
+      {
+        return std::nullopt;
+      }
+      target.insert(target.end(), delta.begin() + position, delta.begin() + position + length);
+      position += length;
+    }
+    else
+    {
+      return std::nullopt;
+    }
+  }
+
+  if (target.size() != header.target_size)
+    return std::nullopt;
+
+  return target;
+}
+}  // namespace Common
@@ -0,0 +1,26 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+
+namespace Common
+{
+// Used by the rewind buffer in State.cpp to store each older savestate as the difference from the
+// next newer one. Both buffers must be full serializations; nothing here tracks which pages changed.
+
+// Encodes target as a sequence of copies from base and literal bytes. Matching blocks are also
+// found when they ended up at a different offset, so a serialized buffer in which an earlier
+// section changed size still produces a small delta.
+std::vector<u8> CreateBinaryDelta(std::span<const u8> base, std::span<const u8> target);
+
+// Reconstructs the target buffer from a delta and the base it was created from. Returns
+// std::nullopt if the delta is malformed or was created from a base of a different size.
+std::optional<std::vector<u8>> ApplyBinaryDelta(std::span<const u8> base,
+                                                std::span<const u8> delta);
+}  // namespace Common
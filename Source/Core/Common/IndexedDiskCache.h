@@ -0,0 +1,489 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/Hash.h"
+#include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
+#include "Common/MappedFile.h"
+#include "Common/Version.h"
+
+// On disk format:
+// header{
+// u32 'DIDC';
+// u16 sizeof(key_type);
+// u16 sizeof(value_type);
+// char version[40];  // scm rev
+// u64 index_offset;  // 0 if the index wasn't written when the file was last closed
+// u64 index_entries;
+//}
+
+// entry{
+// u32 'DENT';
+// u32 value_size;
+// u32 checksum;  // CRC32 of key and value
+// key_type   key;
+// value_type[value_size]   value;
+//}
+
+// index{
+// u32 'DIDX';
+// {key_type key; u64 entry_offset; u32 value_size;}[index_entries]
+//}
+
+namespace Common
+{
+// Key-value store which, unlike LinearDiskCache, doesn't read the whole file when it is opened.
+// Only the index at the end of the file is read, and values are read from a memory mapping when
+// they are looked up. If the file wasn't closed properly, the index is rebuilt from the entry
+// headers instead.
+//
+// Appending a key that is already in the cache replaces its value. Space taken by replaced and
+// erased entries is reclaimed by Compact(), which is also done automatically when opening a file
+// that consists mostly of such entries.
+//
+// K and V are some POD type
+// K : the key type
+// V : value array type
+template <typename K, typename V>
+class IndexedDiskCache
+{
+public:
+  IndexedDiskCache() = default;
+  ~IndexedDiskCache() { Close(); }
+
+  IndexedDiskCache(const IndexedDiskCache&) = delete;
+  IndexedDiskCache& operator=(const IndexedDiskCache&) = delete;
+
+  // Returns the number of entries in the cache. If the file doesn't exist or was written by a
+  // different version, an empty cache is created in its place.
+  u32 Open(const std::string& filename)
+  {
+    // Since we're reading/writing directly to the storage of K and V instances,
+    // they must be trivially copyable.
+    static_assert(std::is_trivially_copyable_v<K>, "K must be a trivially copyable type");
+    static_assert(std::is_trivially_copyable_v<V>, "V must be a trivially copyable type");
+
+    Close();
+    m_filename = filename;
+
+    if (m_file.Open(filename, "r+b") && ReadIndex())
+    {
+      // Mark the index as stale while the file is open, so that the entries are scanned again if
+      // we don't get to write a new index in Close().
+      Header header = Header::Create();
+      header.index_offset = 0;
+      header.index_entries = 0;
+      m_file.Seek(0, File::SeekOrigin::Begin);
+      m_file.WriteArray(&header, 1);
+      m_file.Flush();
+
+      // Only map the file if it still holds everything the index refers to. Reading a mapped page
+      // that lies beyond the end of the file raises SIGBUS, so a file that is shorter than the
+      // index expects is read through m_file instead. The file is never shrunk in place (see
+      // CreateEmptyFile() and WriteIndex()), so nothing below m_mapped_end can disappear later.
+      if (m_file.GetSize() >= m_append_offset && m_mapping.Map(m_file) &&
+          m_mapping.GetSize() >= m_append_offset)
+      {
+        m_mapped_end = m_append_offset;
+      }
+      else
+      {
+        m_mapping.Unmap();
+        m_mapped_end = 0;
+      }
+
+      const u64 garbage_size = m_append_offset - sizeof(Header) - m_live_size;
+      if (garbage_size >= MIN_COMPACTION_SIZE && garbage_size > m_live_size)
+        Compact();
+
+      return static_cast<u32>(m_index.size());
+    }
+
+    // Failed to open file for reading or bad header, close and recreate file
+    m_file.Close();
+    Reset();
+    m_filename = filename;
+    if (CreateEmptyFile(filename))
+      m_file.Open(filename, "r+b");
+    return 0;
+  }
+
+  bool IsOpen() const { return m_file.IsOpen(); }
+  u32 GetEntryCount() const { return static_cast<u32>(m_index.size()); }
+  bool Contains(const K& key) const { return m_index.contains(key); }
+
+  void Sync() { m_file.Flush(); }
+
+  // Writes the index and closes the file.
+  void Close()
+  {
+    if (m_file.IsOpen())
+    {
+      m_mapping.Unmap();
+      WriteIndex(m_file, m_index, m_append_offset);
+      m_file.Close();
+    }
+    Reset();
+  }
+
+  // Returns the value for the given key, or std::nullopt if there is none or its checksum doesn't
+  // match. Entries that fail the checksum are erased.
+  std::optional<std::vector<V>> Lookup(const K& key)
+  {
+    const auto it = m_index.find(key);
+    if (it == m_index.end())
+      return std::nullopt;
+
+    std::optional<std::vector<V>> value = ReadValue(key, it->second);
+    if (!value)
+    {
+      WARN_LOG_FMT(COMMON, "Discarding corrupted entry at offset {} in {}", it->second.offset,
+                   m_filename);
+      m_live_size -= GetEntrySize(it->second.value_size);
+      m_index.erase(it);
+    }
+    return value;
+  }
+
+  // Appends a key-value pair to the store, replacing any value the key already had.
+  void Append(const K& key, const V* value, u32 value_size)
+  {
+    if (!m_file.IsOpen())
+      return;
+
+    const u8* value_bytes = reinterpret_cast<const u8*>(value);
+    const EntryHeader header{ENTRY_MAGIC, value_size,
+                             ComputeChecksum(key, value_bytes, value_size * sizeof(V))};
+
+    if (!m_file.Seek(m_append_offset, File::SeekOrigin::Begin) || !m_file.WriteArray(&header, 1) ||
+        !m_file.WriteArray(&key, 1) || !m_file.WriteBytes(value_bytes, value_size * sizeof(V)))
+    {
+      ERROR_LOG_FMT(COMMON, "Failed to append to {}", m_filename);
+      m_file.ClearError();
+      return;
+    }
+
+    Erase(key);
+    m_index.emplace(key, Location{m_append_offset, value_size});
+    m_live_size += GetEntrySize(value_size);
+    m_append_offset += GetEntrySize(value_size);
+  }
+
+  void Erase(const K& key)
+  {
+    const auto it = m_index.find(key);
+    if (it == m_index.end())
+      return;
+
+    m_live_size -= GetEntrySize(it->second.value_size);
+    m_index.erase(it);
+  }
+
+  // Rewrites the file with only the entries that are still in the index. The cache stays open.
+  bool Compact()
+  {
+    if (!m_file.IsOpen())
+      return false;
+
+    const std::string filename = m_filename;
+    const std::string temp_filename = filename + ".tmp";
+    {
+      File::IOFile temp_file(temp_filename, "wb");
+      const Header header = Header::Create();
+      temp_file.WriteArray(&header, 1);
+
+      Index new_index;
+      u64 offset = sizeof(Header);
+      for (const auto& [key, location] : m_index)
+      {
+        const std::optional<std::vector<V>> value = ReadValue(key, location);
+        if (!value)
+          continue;
+
+        const u8* value_bytes = reinterpret_cast<const u8*>(value->data());
+        const size_t value_bytes_size = value->size() * sizeof(V);
+        const EntryHeader entry_header{ENTRY_MAGIC, location.value_size,
+                                       ComputeChecksum(key, value_bytes, value_bytes_size)};
+        temp_file.WriteArray(&entry_header, 1);
+        temp_file.WriteArray(&key, 1);
+        temp_file.WriteBytes(value_bytes, value_bytes_size);
+
+        new_index.emplace(key, Location{offset, location.value_size});
+        offset += GetEntrySize(location.value_size);
+      }
+
+      if (!WriteIndex(temp_file, new_index, offset))
+      {
+        temp_file.Close();
+        File::Delete(temp_filename);
+        return false;
+      }
+    }
+
+    Close();
+    const bool renamed = File::Rename(temp_filename, filename);
+    if (!renamed)
+      File::Delete(temp_filename);
+    Open(filename);
+    return renamed;
+  }
+
+private:
+  static constexpr u32 HEADER_MAGIC = 0x43444944;  // "DIDC"
+  static constexpr u32 ENTRY_MAGIC = 0x544E4544;   // "DENT"
+  static constexpr u32 INDEX_MAGIC = 0x58444944;   // "DIDX"
+
+  // Don't bother rewriting the file for less garbage than this
+  static constexpr u64 MIN_COMPACTION_SIZE = 1024 * 1024;
+
+  struct Header
+  {
+    static Header Create()
+    {
+      Header header;
+      // Null-terminator is intentionally not copied.
+      const std::string& version = Common::GetScmRevGitStr();
+      std::memcpy(header.ver, version.c_str(), std::min(version.size(), sizeof(header.ver)));
+      return header;
+    }
+
+    bool IsCompatibleWith(const Header& other) const
+    {
+      return id == other.id && key_t_size == other.key_t_size &&
+             value_t_size == other.value_t_size && std::memcmp(ver, other.ver, sizeof(ver)) == 0;
+    }
+
+    u32 id = HEADER_MAGIC;
+    u16 key_t_size = sizeof(K);
+    u16 value_t_size = sizeof(V);
+    char ver[40] = {};
+    u64 index_offset = 0;
+    u64 index_entries = 0;
+  };
+
+  struct EntryHeader
+  {
+    u32 magic;
+    u32 value_size;
+    u32 checksum;
+  };
+
+  struct Location
+  {
+    u64 offset;
+    u32 value_size;
+  };
+
+  // Keys are compared bytewise, so that K doesn't need to have any operators.
+  struct KeyLess
+  {
+    bool operator()(const K& a, const K& b) const { return std::memcmp(&a, &b, sizeof(K)) < 0; }
+  };
+
+  using Index = std::map<K, Location, KeyLess>;
+
+  static constexpr u64 GetEntrySize(u32 value_size)
+  {
+    return sizeof(EntryHeader) + sizeof(K) + u64(value_size) * sizeof(V);
+  }
+
+  static u32 ComputeChecksum(const K& key, const u8* value, size_t value_bytes)
+  {
+    const u32 checksum = UpdateCRC32(StartCRC32(), reinterpret_cast<const u8*>(&key), sizeof(K));
+    return UpdateCRC32(checksum, value, value_bytes);
+  }
+
+  // Replaces the file with one that only has a header. The new file is written next to the old one
+  // and renamed over it rather than truncating the old file, which another instance may still have
+  // mapped.
+  static bool CreateEmptyFile(const std::string& filename)
+  {
+    const std::string temp_filename = filename + ".tmp";
+    {
+      File::IOFile temp_file(temp_filename, "wb");
+      const Header header = Header::Create();
+      if (!temp_file.WriteArray(&header, 1))
+      {
+        temp_file.Close();
+        File::Delete(temp_filename);
+        return false;
+      }
+    }
+
+    if (File::Rename(temp_filename, filename))
+      return true;
+
+    File::Delete(temp_filename);
+    return false;
+  }
+
+  std::optional<std::vector<V>> ReadValue(const K& key, const Location& location)
+  {
+    const u64 entry_size = GetEntrySize(location.value_size);
+    const size_t value_bytes = location.value_size * sizeof(V);
+
+    // Entries that were appended after the file was mapped have to be read from the file.
+    std::vector<u8> buffer;
+    const u8* entry;
+    if (location.offset + entry_size <= m_mapped_end)
+    {
+      entry = m_mapping.GetSpan().data() + location.offset;
+    }
+    else
+    {
+      buffer.resize(entry_size);
+      m_file.Flush();
+      if (!m_file.Seek(location.offset, File::SeekOrigin::Begin) ||
+          !m_file.ReadBytes(buffer.data(), buffer.size()))
+      {
+        m_file.ClearError();
+        return std::nullopt;
+      }
+      entry = buffer.data();
+    }
+
+    EntryHeader header;
+    std::memcpy(&header, entry, sizeof(header));
+    const u8* key_and_value = entry + sizeof(header);
+    if (header.magic != ENTRY_MAGIC || header.value_size != location.value_size ||
+        header.checksum != ComputeChecksum(key, key_and_value + sizeof(K), value_bytes) ||
+        std::memcmp(key_and_value, &key, sizeof(K)) != 0)
+    {
+      return std::nullopt;
+    }
+
+    std::vector<V> value(location.value_size);
+    std::memcpy(value.data(), key_and_value + sizeof(K), value_bytes);
+    return value;
+  }
+
+  static bool WriteIndex(File::IOFile& file, const Index& index, u64 index_offset)
+  {
+    file.Seek(index_offset, File::SeekOrigin::Begin);
+    file.WriteArray(&INDEX_MAGIC, 1);
+    for (const auto& [key, location] : index)
+    {
+      file.WriteArray(&key, 1);
+      file.WriteArray(&location.offset, 1);
+      file.WriteArray(&location.value_size, 1);
+    }
+
+    Header header = Header::Create();
+    header.index_offset = index_offset;
+    header.index_entries = index.size();
+    file.Seek(0, File::SeekOrigin::Begin);
+    file.WriteArray(&header, 1);
+
+    // Whatever is left after the index by a file that was longer before is ignored when reading
+    // it. The file isn't truncated, as other instances may have it mapped; Compact() reclaims the
+    // space by writing a new file instead.
+    file.Flush();
+    return file.IsGood();
+  }
+
+  bool ReadIndex()
+  {
+    Header header;
+    if (!m_file.ReadArray(&header, 1) || !Header::Create().IsCompatibleWith(header))
+      return false;
+
+    const u64 file_size = m_file.GetSize();
+    if (header.index_offset != 0 && ReadIndexAt(header, file_size))
+    {
+      m_append_offset = header.index_offset;
+      return true;
+    }
+
+    ScanEntries(file_size);
+    return true;
+  }
+
+  bool ReadIndexAt(const Header& header, u64 file_size)
+  {
+    constexpr u64 index_entry_size = sizeof(K) + sizeof(u64) + sizeof(u32);
+    if (header.index_offset < sizeof(Header) || header.index_offset > file_size ||
+        header.index_entries > (file_size - header.index_offset) / index_entry_size)
+    {
+      return false;
+    }
+
+    u32 magic;
+    m_file.Seek(header.index_offset, File::SeekOrigin::Begin);
+    if (!m_file.ReadArray(&magic, 1) || magic != INDEX_MAGIC)
+      return false;
+
+    for (u64 i = 0; i < header.index_entries; ++i)
+    {
+      K key;
+      Location location;
+      if (!m_file.ReadArray(&key, 1) || !m_file.ReadArray(&location.offset, 1) ||
+          !m_file.ReadArray(&location.value_size, 1) || location.offset < sizeof(Header) ||
+          location.offset + GetEntrySize(location.value_size) > header.index_offset)
+      {
+        m_index.clear();
+        m_live_size = 0;
+        return false;
+      }
+
+      m_index.insert_or_assign(key, location);
+    }
+
+    for (const auto& [key, location] : m_index)
+      m_live_size += GetEntrySize(location.value_size);
+    return true;
+  }
+
+  // Rebuilds the index from the entry headers, stopping at the first entry that is incomplete.
+  void ScanEntries(u64 file_size)
+  {
+    u64 offset = sizeof(Header);
+    EntryHeader header;
+    K key;
+    while (m_file.Seek(offset, File::SeekOrigin::Begin) && m_file.ReadArray(&header, 1) &&
+           header.magic == ENTRY_MAGIC && offset + GetEntrySize(header.value_size) <= file_size &&
+           m_file.ReadArray(&key, 1))
+    {
+      Erase(key);
+      m_index.emplace(key, Location{offset, header.value_size});
+      m_live_size += GetEntrySize(header.value_size);
+      offset += GetEntrySize(header.value_size);
+    }
+
+    m_file.ClearError();
+    m_append_offset = offset;
+    WARN_LOG_FMT(COMMON, "Rebuilt the index of {} with {} entries", m_filename, m_index.size());
+  }
+
+  void Reset()
+  {
+    m_filename.clear();
+    m_index.clear();
+    m_live_size = 0;
+    m_append_offset = sizeof(Header);
+    m_mapped_end = 0;
+  }
+
+  std::string m_filename;
+  File::IOFile m_file;
+  File::MappedFile m_mapping;
+  Index m_index;
+
+  // Total size of the entries that are in the index. Everything else before m_append_offset is
+  // garbage left by replaced or erased entries.
+  u64 m_live_size = 0;
+  u64 m_append_offset = sizeof(Header);
+  u64 m_mapped_end = 0;
+};
+}  // namespace Common
@@ -0,0 +1,42 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <span>
+
+#include "Common/CommonTypes.h"
+
+namespace File
+{
+class IOFile;
+
+// A read-only memory mapping of an entire file. Reading from the mapping is served straight from
+// the OS page cache, without a seek and read system call for every access.
+class MappedFile
+{
+public:
+  MappedFile() = default;
+  ~MappedFile();
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  MappedFile(MappedFile&& other) noexcept;
+  MappedFile& operator=(MappedFile&& other) noexcept;
+
+  // Maps the whole file that the given IOFile has open. The IOFile can be closed afterwards.
+  // Returns false if the file could not be mapped, for instance because it is empty.
+  bool Map(IOFile& file);
+  void Unmap();
+
+  bool IsMapped() const { return m_data != nullptr; }
+  u64 GetSize() const { return m_size; }
+  std::span<const u8> GetSpan() const { return {m_data, static_cast<size_t>(m_size)}; }
+
+private:
+  const u8* m_data = nullptr;
+  u64 m_size = 0;
+};
+
+}  // namespace File
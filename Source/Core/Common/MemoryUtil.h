@@ -34,5 +34,7 @@ bool ReadProtectMemory(void* ptr, size_t size);
 bool WriteProtectMemory(void* ptr, size_t size, bool executable = false);
 bool UnWriteProtectMemory(void* ptr, size_t size, bool allowExecute = false);
 size_t MemPhysical();
+// The largest amount of physical memory this process has used so far, or 0 if it's unknown.
+size_t MemPeakResident();
 
 }  // namespace Common
@@ -116,6 +116,10 @@ extern const Info<int> MAIN_SYNC_GPU_MAX_DISTANCE;
 extern const Info<int> MAIN_SYNC_GPU_MIN_DISTANCE;
 extern const Info<float> MAIN_SYNC_GPU_OVERCLOCK;
 extern const Info<bool> MAIN_FAST_DISC_SPEED;
+// Serve reads of plain and split disc images from a memory mapping. Off by default, as a read
+// from a mapping crashes with SIGBUS if the file is truncated or its storage goes away, which can
+// happen for images on network shares or removable drives.
+extern const Info<bool> MAIN_MAP_DISC_IMAGES;
 extern const Info<bool> MAIN_LOW_DCBZ_HACK;
 extern const Info<bool> MAIN_FLOAT_EXCEPTIONS;
 extern const Info<bool> MAIN_DIVIDE_BY_ZERO_EXCEPTIONS;
@@ -150,6 +154,11 @@ extern const Info<u32> MAIN_CUSTOM_RTC_VALUE;
 extern const Info<bool> MAIN_AUTO_DISC_CHANGE;
 extern const Info<bool> MAIN_ALLOW_SD_WRITES;
 extern const Info<bool> MAIN_ENABLE_SAVESTATES;
+// 0 uses LZ4, anything higher uses zstd at that level
+extern const Info<int> MAIN_SAVESTATE_ZSTD_LEVEL;
+// 0 disables rewind
+extern const Info<u32> MAIN_REWIND_FRAME_INTERVAL;
+extern const Info<u32> MAIN_REWIND_MEMORY_LIMIT_MB;
 extern const Info<DiscIO::Region> MAIN_FALLBACK_REGION;
 extern const Info<bool> MAIN_REAL_WII_REMOTE_REPEAT_REPORTS;
 extern const Info<s32> MAIN_OVERRIDE_BOOT_IOS;
@@ -301,6 +310,8 @@ extern const Info<bool> MAIN_GAMELIST_COLUMN_TAGS;
 
 extern const Info<bool> MAIN_FIFOPLAYER_LOOP_REPLAY;
 extern const Info<bool> MAIN_FIFOPLAYER_EARLY_MEMORY_UPDATES;
+// Save FIFO logs with compressed frames, which versions before DFF version 6 can't load
+extern const Info<bool> MAIN_FIFOPLAYER_COMPRESS_FRAMES;
 
 // Main.AutoUpdate
 
@@ -6,21 +6,32 @@
 #include <algorithm>
 #include <cstring>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
+#include <zstd.h>
+
 #include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/HW/Memmap.h"
 #include "Core/System.h"
 
 constexpr u32 FILE_ID = 0x0d01f1f0;
-constexpr u32 VERSION_NUMBER = 5;
+constexpr u32 VERSION_NUMBER = 6;
 constexpr u32 MIN_LOADER_VERSION = 1;
 // This value is only used if the DFF file was created with overridden RAM sizes.
 // If the MIN_LOADER_VERSION ever exceeds this, it's alright to remove it.
 constexpr u32 MIN_LOADER_VERSION_FOR_RAM_OVERRIDE = 5;
+// Only used if the frames are stored as compressed chunks, which older loaders can't read.
+constexpr u32 MIN_LOADER_VERSION_FOR_COMPRESSED_FRAMES = 6;
+
+// FIFO data is very repetitive, so a fast level already gets most of the gains while keeping up
+// with recording.
+constexpr int FRAME_COMPRESSION_LEVEL = 3;
+constexpr size_t DECOMPRESSED_FRAME_CACHE_SIZE = 8;
 
 #pragma pack(push, 1)
 
@@ -58,7 +69,12 @@ struct FileFrameInfo
   u32 fifoEnd;
   u64 memoryUpdatesOffset;
   u32 numMemoryUpdates;
-  u8 reserved[32];
+  // Only used with FLAG_COMPRESSED_FRAMES. The offsets above are then relative to the start of
+  // the decompressed chunk.
+  u64 chunkOffset;
+  u32 chunkCompressedSize;
+  u32 chunkSize;
+  u8 reserved[16];
 };
 static_assert(sizeof(FileFrameInfo) == 64, "FileFrameInfo should be 64 bytes");
 
@@ -77,7 +93,11 @@ static_assert(sizeof(FileMemoryUpdate) == 24, "FileMemoryUpdate should be 24 byt
 
 FifoDataFile::FifoDataFile() = default;
 
-FifoDataFile::~FifoDataFile() = default;
+FifoDataFile::~FifoDataFile()
+{
+  // Frames that haven't been compressed yet don't need to be anymore
+  m_compression_thread.Shutdown(true);
+}
 
 bool FifoDataFile::ShouldGenerateFakeVIUpdates() const
 {
@@ -99,13 +119,206 @@ bool FifoDataFile::GetIsWii() const
   return GetFlag(FLAG_IS_WII);
 }
 
+FifoDataFile::StoredFrame FifoDataFile::StoreDecodedFrame(FifoFrameInfo frame)
+{
+  StoredFrame stored;
+  stored.fifo_data_size = static_cast<u32>(frame.fifoData.size());
+  stored.fifo_start = frame.fifoStart;
+  stored.fifo_end = frame.fifoEnd;
+  stored.num_memory_updates = static_cast<u32>(frame.memoryUpdates.size());
+  for (const MemoryUpdate& update : frame.memoryUpdates)
+    stored.memory_update_data_size += update.data.size();
+  stored.decoded = std::make_shared<const FifoFrameInfo>(std::move(frame));
+  return stored;
+}
+
 void FifoDataFile::AddFrame(const FifoFrameInfo& frameInfo)
 {
-  m_Frames.push_back(frameInfo);
+  u32 frame;
+  {
+    std::lock_guard lk(m_frames_lock);
+    frame = static_cast<u32>(m_Frames.size());
+    m_Frames.push_back(StoreDecodedFrame(frameInfo));
+  }
+
+  if (!m_compression_thread_started)
+  {
+    m_compression_thread.Reset("FIFO Log Compression", [this](u32 index) { CompressFrame(index); });
+    m_compression_thread_started = true;
+  }
+  m_compression_thread.Push(frame);
+}
+
+std::shared_ptr<const FifoFrameInfo> FifoDataFile::GetFrame(u32 frame) const
+{
+  std::lock_guard lk(m_frames_lock);
+
+  const StoredFrame& stored = m_Frames[frame];
+  if (stored.decoded)
+    return stored.decoded;
+
+  const auto it = std::ranges::find(m_decompressed_frames, frame,
+                                    &decltype(m_decompressed_frames)::value_type::first);
+  if (it != m_decompressed_frames.end())
+    return it->second;
+
+  std::shared_ptr<const FifoFrameInfo> decoded = DecompressChunk(stored);
+  if (!decoded)
+  {
+    ERROR_LOG_FMT(VIDEO, "Failed to decompress frame {} of the FIFO log", frame);
+    auto empty_frame = std::make_shared<FifoFrameInfo>();
+    empty_frame->fifoStart = stored.fifo_start;
+    empty_frame->fifoEnd = stored.fifo_end;
+    decoded = std::move(empty_frame);
+  }
+
+  if (m_decompressed_frames.size() == DECOMPRESSED_FRAME_CACHE_SIZE)
+    m_decompressed_frames.pop_back();
+  m_decompressed_frames.emplace_front(frame, decoded);
+
+  return decoded;
+}
+
+u32 FifoDataFile::GetFrameCount() const
+{
+  std::lock_guard lk(m_frames_lock);
+  return static_cast<u32>(m_Frames.size());
+}
+
+u64 FifoDataFile::GetFifoDataSize() const
+{
+  std::lock_guard lk(m_frames_lock);
+  u64 size = 0;
+  for (const StoredFrame& frame : m_Frames)
+    size += frame.fifo_data_size;
+  return size;
+}
+
+u64 FifoDataFile::GetMemoryUpdateDataSize() const
+{
+  std::lock_guard lk(m_frames_lock);
+  u64 size = 0;
+  for (const StoredFrame& frame : m_Frames)
+    size += frame.memory_update_data_size;
+  return size;
+}
+
+void FifoDataFile::CompressFrame(u32 frame)
+{
+  std::shared_ptr<const FifoFrameInfo> decoded;
+  {
+    std::lock_guard lk(m_frames_lock);
+    decoded = m_Frames[frame].decoded;
+  }
+
+  u32 chunk_size;
+  std::vector<u8> compressed = CompressChunk(*decoded, &chunk_size);
+  if (compressed.empty())
+    return;
+
+  std::lock_guard lk(m_frames_lock);
+  StoredFrame& stored = m_Frames[frame];
+  stored.compressed_storage = std::move(compressed);
+  stored.chunk_size = chunk_size;
+  stored.decoded.reset();
+}
+
+std::vector<u8> FifoDataFile::CompressChunk(const FifoFrameInfo& frame, u32* chunk_size)
+{
+  // A chunk contains the FIFO data, followed by the memory update list and the updated memory
+  const size_t list_offset = frame.fifoData.size();
+  size_t data_offset = list_offset + frame.memoryUpdates.size() * sizeof(FileMemoryUpdate);
+  size_t size = data_offset;
+  for (const MemoryUpdate& update : frame.memoryUpdates)
+    size += update.data.size();
+
+  std::vector<u8> chunk(size);
+  std::ranges::copy(frame.fifoData, chunk.begin());
+  for (size_t i = 0; i < frame.memoryUpdates.size(); ++i)
+  {
+    const MemoryUpdate& srcUpdate = frame.memoryUpdates[i];
+
+    FileMemoryUpdate dstUpdate{};
+    dstUpdate.address = srcUpdate.address;
+    dstUpdate.dataOffset = data_offset;
+    dstUpdate.dataSize = static_cast<u32>(srcUpdate.data.size());
+    dstUpdate.fifoPosition = srcUpdate.fifoPosition;
+    dstUpdate.type = static_cast<u8>(srcUpdate.type);
+    std::memcpy(chunk.data() + list_offset + i * sizeof(FileMemoryUpdate), &dstUpdate,
+                sizeof(FileMemoryUpdate));
+
+    std::ranges::copy(srcUpdate.data, chunk.begin() + data_offset);
+    data_offset += srcUpdate.data.size();
+  }
+
+  std::vector<u8> compressed(ZSTD_compressBound(size));
+  const size_t compressed_size = ZSTD_compress(compressed.data(), compressed.size(), chunk.data(),
+                                               size, FRAME_COMPRESSION_LEVEL);
+  if (ZSTD_isError(compressed_size))
+  {
+    ERROR_LOG_FMT(VIDEO, "Failed to compress FIFO log frame: {}",
+                  ZSTD_getErrorName(compressed_size));
+    return {};
+  }
+
+  compressed.resize(compressed_size);
+  compressed.shrink_to_fit();
+  *chunk_size = static_cast<u32>(size);
+  return compressed;
+}
+
+std::shared_ptr<const FifoFrameInfo> FifoDataFile::DecompressChunk(const StoredFrame& frame)
+{
+  const std::span<const u8> compressed = frame.compressed_storage.empty() ?
+                                             frame.mapped_chunk :
+                                             std::span<const u8>(frame.compressed_storage);
+
+  std::vector<u8> chunk(frame.chunk_size);
+  const size_t result =
+      ZSTD_decompress(chunk.data(), chunk.size(), compressed.data(), compressed.size());
+  if (ZSTD_isError(result) || result != chunk.size())
+    return nullptr;
+
+  const size_t list_size = size_t(frame.num_memory_updates) * sizeof(FileMemoryUpdate);
+  if (frame.fifo_data_size > chunk.size() || list_size > chunk.size() - frame.fifo_data_size)
+    return nullptr;
+
+  auto decoded = std::make_shared<FifoFrameInfo>();
+  decoded->fifoData.assign(chunk.begin(), chunk.begin() + frame.fifo_data_size);
+  decoded->fifoStart = frame.fifo_start;
+  decoded->fifoEnd = frame.fifo_end;
+
+  decoded->memoryUpdates.resize(frame.num_memory_updates);
+  for (u32 i = 0; i < frame.num_memory_updates; ++i)
+  {
+    FileMemoryUpdate srcUpdate;
+    std::memcpy(&srcUpdate, chunk.data() + frame.fifo_data_size + i * sizeof(FileMemoryUpdate),
+                sizeof(FileMemoryUpdate));
+    if (srcUpdate.dataOffset > chunk.size() ||
+        srcUpdate.dataSize > chunk.size() - srcUpdate.dataOffset)
+    {
+      return nullptr;
+    }
+
+    MemoryUpdate& dstUpdate = decoded->memoryUpdates[i];
+    dstUpdate.address = srcUpdate.address;
+    dstUpdate.fifoPosition = srcUpdate.fifoPosition;
+    dstUpdate.type = static_cast<MemoryUpdate::Type>(srcUpdate.type);
+    dstUpdate.data.assign(chunk.begin() + srcUpdate.dataOffset,
+                          chunk.begin() + srcUpdate.dataOffset + srcUpdate.dataSize);
+  }
+
+  return decoded;
 }
 
 bool FifoDataFile::Save(const std::string& filename)
 {
+  // Frames that were just recorded might still be being compressed
+  if (m_compression_thread_started)
+    m_compression_thread.WaitForCompletion();
+
+  std::lock_guard lk(m_frames_lock);
+
   File::IOFile file;
   if (!file.Open(filename, "wb"))
     return false;
@@ -136,8 +349,13 @@ bool FifoDataFile::Save(const std::string& filename)
   FileHeader header;
   header.fileId = FILE_ID;
   header.file_version = VERSION_NUMBER;
-  // Maintain backwards compatability so long as the RAM sizes aren't overridden.
-  if (Config::Get(Config::MAIN_RAM_OVERRIDE_ENABLE))
+
+  // Maintain backwards compatability so long as the RAM sizes aren't overridden and the frames
+  // aren't compressed.
+  const bool compress_frames = Config::Get(Config::MAIN_FIFOPLAYER_COMPRESS_FRAMES);
+  if (compress_frames)
+    header.min_loader_version = MIN_LOADER_VERSION_FOR_COMPRESSED_FRAMES;
+  else if (Config::Get(Config::MAIN_RAM_OVERRIDE_ENABLE))
     header.min_loader_version = MIN_LOADER_VERSION_FOR_RAM_OVERRIDE;
   else
     header.min_loader_version = MIN_LOADER_VERSION;
@@ -160,6 +378,7 @@ bool FifoDataFile::Save(const std::string& filename)
   header.frameListOffset = frameListOffset;
   header.frameCount = (u32)m_Frames.size();
 
+  SetFlag(FLAG_COMPRESSED_FRAMES, compress_frames);
   header.flags = m_Flags;
 
   auto& system = Core::System::GetInstance();
@@ -173,22 +392,70 @@ bool FifoDataFile::Save(const std::string& filename)
   // Write frames list
   for (unsigned int i = 0; i < m_Frames.size(); ++i)
   {
-    const FifoFrameInfo& srcFrame = m_Frames[i];
-
-    // Write FIFO data
+    const StoredFrame& srcFrame = m_Frames[i];
+
+    if (!compress_frames)
+    {
+      const std::shared_ptr<const FifoFrameInfo> decoded =
+          srcFrame.decoded ? srcFrame.decoded : DecompressChunk(srcFrame);
+      if (!decoded)
+        return false;
+
+      // Write FIFO data
+      file.Seek(0, File::SeekOrigin::End);
+      u64 dataOffset = file.Tell();
+      file.WriteBytes(decoded->fifoData.data(), decoded->fifoData.size());
+
+      u64 memoryUpdatesOffset = WriteMemoryUpdates(decoded->memoryUpdates, file);
+
+      FileFrameInfo dstFrame{};
+      dstFrame.fifoDataSize = static_cast<u32>(decoded->fifoData.size());
+      dstFrame.fifoDataOffset = dataOffset;
+      dstFrame.fifoStart = decoded->fifoStart;
+      dstFrame.fifoEnd = decoded->fifoEnd;
+      dstFrame.memoryUpdatesOffset = memoryUpdatesOffset;
+      dstFrame.numMemoryUpdates = static_cast<u32>(decoded->memoryUpdates.size());
+
+      // Write frame info
+      u64 frameOffset = frameListOffset + (i * sizeof(FileFrameInfo));
+      file.Seek(frameOffset, File::SeekOrigin::Begin);
+      file.WriteBytes(&dstFrame, sizeof(FileFrameInfo));
+      continue;
+    }
+
+    // Frames loaded from old files haven't been compressed yet
+    std::vector<u8> compressed_storage;
+    std::span<const u8> compressed;
+    u32 chunk_size = srcFrame.chunk_size;
+    if (srcFrame.decoded)
+    {
+      compressed_storage = CompressChunk(*srcFrame.decoded, &chunk_size);
+      if (compressed_storage.empty())
+        return false;
+      compressed = compressed_storage;
+    }
+    else
+    {
+      compressed = srcFrame.compressed_storage.empty() ?
+                       srcFrame.mapped_chunk :
+                       std::span<const u8>(srcFrame.compressed_storage);
+    }
+
+    // Write compressed chunk
     file.Seek(0, File::SeekOrigin::End);
-    u64 dataOffset = file.Tell();
-    file.WriteBytes(srcFrame.fifoData.data(), srcFrame.fifoData.size());
-
-    u64 memoryUpdatesOffset = WriteMemoryUpdates(srcFrame.memoryUpdates, file);
-
-    FileFrameInfo dstFrame;
-    dstFrame.fifoDataSize = static_cast<u32>(srcFrame.fifoData.size());
-    dstFrame.fifoDataOffset = dataOffset;
-    dstFrame.fifoStart = srcFrame.fifoStart;
-    dstFrame.fifoEnd = srcFrame.fifoEnd;
-    dstFrame.memoryUpdatesOffset = memoryUpdatesOffset;
-    dstFrame.numMemoryUpdates = static_cast<u32>(srcFrame.memoryUpdates.size());
+    u64 chunkOffset = file.Tell();
+    file.WriteBytes(compressed.data(), compressed.size());
+
+    FileFrameInfo dstFrame{};
+    dstFrame.fifoDataSize = srcFrame.fifo_data_size;
+    dstFrame.fifoDataOffset = 0;
+    dstFrame.fifoStart = srcFrame.fifo_start;
+    dstFrame.fifoEnd = srcFrame.fifo_end;
+    dstFrame.memoryUpdatesOffset = srcFrame.fifo_data_size;
+    dstFrame.numMemoryUpdates = srcFrame.num_memory_updates;
+    dstFrame.chunkOffset = chunkOffset;
+    dstFrame.chunkCompressedSize = static_cast<u32>(compressed.size());
+    dstFrame.chunkSize = chunk_size;
 
     // Write frame info
     u64 frameOffset = frameListOffset + (i * sizeof(FileFrameInfo));
@@ -202,6 +469,19 @@ bool FifoDataFile::Save(const std::string& filename)
   return true;
 }
 
+std::optional<u32> FifoDataFile::ReadFrameCount(const std::string& filename)
+{
+  File::IOFile file(filename, "rb");
+  FileHeader header;
+  if (!file.ReadBytes(&header, sizeof(header)) || header.fileId != FILE_ID ||
+      header.min_loader_version > VERSION_NUMBER)
+  {
+    return std::nullopt;
+  }
+
+  return header.frameCount;
+}
+
 std::unique_ptr<FifoDataFile> FifoDataFile::Load(const std::string& filename, bool flagsOnly)
 {
   File::IOFile file;
@@ -316,7 +596,17 @@ std::unique_ptr<FifoDataFile> FifoDataFile::Load(const std::string& filename, bo
   dataFile->m_ram_size_real = header.mem1_size;
   dataFile->m_exram_size_real = header.mem2_size;
 
+  // Compressed frames are only decompressed once they are used. Reading them straight out of a
+  // mapping of the file means that only the frames that are used get paged in. If the file can't
+  // be mapped, the compressed frames are read into memory instead.
+  const bool compressed_frames =
+      header.file_version >= 6 && dataFile->GetFlag(FLAG_COMPRESSED_FRAMES);
+  if (compressed_frames)
+    dataFile->m_mapped_file.Map(file);
+  const u64 file_size = file.GetSize();
+
   // Read frames
+  dataFile->m_Frames.reserve(header.frameCount);
   for (u32 i = 0; i < header.frameCount; ++i)
   {
     u64 frameOffset = header.frameListOffset + (i * sizeof(FileFrameInfo));
@@ -325,6 +615,40 @@ std::unique_ptr<FifoDataFile> FifoDataFile::Load(const std::string& filename, bo
     if (!file.ReadBytes(&srcFrame, sizeof(FileFrameInfo)))
       return panic_failed_to_read();
 
+    if (compressed_frames)
+    {
+      const u64 list_size = u64(srcFrame.numMemoryUpdates) * sizeof(FileMemoryUpdate);
+      if (srcFrame.chunkOffset > file_size ||
+          srcFrame.chunkCompressedSize > file_size - srcFrame.chunkOffset ||
+          u64(srcFrame.fifoDataSize) + list_size > srcFrame.chunkSize)
+      {
+        return panic_failed_to_read();
+      }
+
+      StoredFrame dstFrame;
+      if (dataFile->m_mapped_file.IsMapped())
+      {
+        dstFrame.mapped_chunk = dataFile->m_mapped_file.GetSpan().subspan(
+            srcFrame.chunkOffset, srcFrame.chunkCompressedSize);
+      }
+      else
+      {
+        dstFrame.compressed_storage.resize(srcFrame.chunkCompressedSize);
+        file.Seek(srcFrame.chunkOffset, File::SeekOrigin::Begin);
+        if (!file.ReadBytes(dstFrame.compressed_storage.data(), srcFrame.chunkCompressedSize))
+          return panic_failed_to_read();
+      }
+      dstFrame.chunk_size = srcFrame.chunkSize;
+      dstFrame.fifo_data_size = srcFrame.fifoDataSize;
+      dstFrame.fifo_start = srcFrame.fifoStart;
+      dstFrame.fifo_end = srcFrame.fifoEnd;
+      dstFrame.num_memory_updates = srcFrame.numMemoryUpdates;
+      dstFrame.memory_update_data_size = srcFrame.chunkSize - srcFrame.fifoDataSize - list_size;
+
+      dataFile->m_Frames.push_back(std::move(dstFrame));
+      continue;
+    }
+
     FifoFrameInfo dstFrame;
     dstFrame.fifoData.resize(srcFrame.fifoDataSize);
     dstFrame.fifoStart = srcFrame.fifoStart;
@@ -339,7 +663,7 @@ std::unique_ptr<FifoDataFile> FifoDataFile::Load(const std::string& filename, bo
     if (!file.IsGood())
       return panic_failed_to_read();
 
-    dataFile->AddFrame(dstFrame);
+    dataFile->m_Frames.push_back(StoreDecodedFrame(std::move(dstFrame)));
   }
 
   return dataFile;
@@ -380,7 +704,7 @@ u64 FifoDataFile::WriteMemoryUpdates(const std::vector<MemoryUpdate>& memUpdates
     u64 dataOffset = file.Tell();
     file.WriteBytes(srcUpdate.data.data(), srcUpdate.data.size());
 
-    FileMemoryUpdate dstUpdate;
+    FileMemoryUpdate dstUpdate{};
     dstUpdate.address = srcUpdate.address;
     dstUpdate.dataOffset = dataOffset;
     dstUpdate.dataSize = static_cast<u32>(srcUpdate.data.size());
@@ -4,11 +4,18 @@
 #pragma once
 
 #include <array>
+#include <deque>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/MappedFile.h"
+#include "Common/WorkQueueThread.h"
 #include "VideoCommon/XFMemory.h"
 
 namespace File
@@ -72,17 +79,47 @@ public:
   u32 GetRamSizeReal() { return m_ram_size_real; }
   u32 GetExRamSizeReal() { return m_exram_size_real; }
 
+  // Frames added while recording are compressed on a background thread to keep the memory usage
+  // of long recordings down.
   void AddFrame(const FifoFrameInfo& frameInfo);
-  const FifoFrameInfo& GetFrame(u32 frame) const { return m_Frames[frame]; }
-  u32 GetFrameCount() const { return static_cast<u32>(m_Frames.size()); }
+  // Frames that are stored compressed are decompressed on demand. The returned frame stays valid
+  // for as long as the caller holds on to it.
+  std::shared_ptr<const FifoFrameInfo> GetFrame(u32 frame) const;
+  u32 GetFrameCount() const;
+  // Sums over all frames, without decompressing any of them.
+  u64 GetFifoDataSize() const;
+  u64 GetMemoryUpdateDataSize() const;
   bool Save(const std::string& filename);
 
   static std::unique_ptr<FifoDataFile> Load(const std::string& filename, bool flagsOnly);
+  // Only reads the header, without showing any alerts. Returns std::nullopt if the file isn't a
+  // DFF file that can be loaded.
+  static std::optional<u32> ReadFrameCount(const std::string& filename);
 
 private:
   enum
   {
-    FLAG_IS_WII = 1
+    FLAG_IS_WII = 1,
+    // Each frame is stored as a single zstd compressed chunk, see StoredFrame. Only written if
+    // MAIN_FIFOPLAYER_COMPRESS_FRAMES is enabled.
+    FLAG_COMPRESSED_FRAMES = 2,
+  };
+
+  struct StoredFrame
+  {
+    // Set for frames that haven't been compressed (yet) and for frames from old files
+    std::shared_ptr<const FifoFrameInfo> decoded;
+
+    // The compressed chunk, which is either in compressed_storage or in m_mapped_file
+    std::vector<u8> compressed_storage;
+    std::span<const u8> mapped_chunk;
+    u32 chunk_size = 0;
+
+    u32 fifo_data_size = 0;
+    u32 fifo_start = 0;
+    u32 fifo_end = 0;
+    u32 num_memory_updates = 0;
+    u64 memory_update_data_size = 0;
   };
 
   void PadFile(size_t numBytes, File::IOFile& file);
@@ -90,6 +127,11 @@ private:
   void SetFlag(u32 flag, bool set);
   bool GetFlag(u32 flag) const;
 
+  static StoredFrame StoreDecodedFrame(FifoFrameInfo frame);
+  void CompressFrame(u32 frame);
+  static std::vector<u8> CompressChunk(const FifoFrameInfo& frame, u32* chunk_size);
+  static std::shared_ptr<const FifoFrameInfo> DecompressChunk(const StoredFrame& frame);
+
   u64 WriteMemoryUpdates(const std::vector<MemoryUpdate>& memUpdates, File::IOFile& file);
   static void ReadMemoryUpdates(u64 fileOffset, u32 numUpdates,
                                 std::vector<MemoryUpdate>& memUpdates, File::IOFile& file);
@@ -105,5 +147,15 @@ private:
   u32 m_Flags = 0;
   u32 m_Version = 0;
 
-  std::vector<FifoFrameInfo> m_Frames;
+  // Guards m_Frames and m_decompressed_frames, which are accessed by the video thread while
+  // recording, by the compression thread and by the GUI.
+  mutable std::mutex m_frames_lock;
+  std::vector<StoredFrame> m_Frames;
+  // The most recently decompressed frames, so that playing back a frame over and over or
+  // stepping through a frame in the analyzer doesn't decompress it every time.
+  mutable std::deque<std::pair<u32, std::shared_ptr<const FifoFrameInfo>>> m_decompressed_frames;
+  File::MappedFile m_mapped_file;
+
+  bool m_compression_thread_started = false;
+  Common::WorkQueueThread<u32> m_compression_thread;
 };
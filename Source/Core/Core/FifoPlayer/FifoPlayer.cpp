@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <memory>
 #include <mutex>
 #include <type_traits>
 
@@ -80,9 +81,13 @@ void FifoPlaybackAnalyzer::AnalyzeFrames(FifoDataFile* file,
   frame_info.clear();
   frame_info.resize(file->GetFrameCount());
 
+  // For logs with compressed frames, this decompresses every frame once when the log is loaded.
+  // The CP state carries over from one frame to the next, so a single frame can't be analyzed on
+  // its own when it's first needed.
   for (u32 frame_no = 0; frame_no < file->GetFrameCount(); frame_no++)
   {
-    const FifoFrameInfo& frame = file->GetFrame(frame_no);
+    const std::shared_ptr<const FifoFrameInfo> frame_data = file->GetFrame(frame_no);
+    const FifoFrameInfo& frame = *frame_data;
     AnalyzedFrameInfo& analyzed = frame_info[frame_no];
 
     u32 offset = 0;
@@ -297,7 +302,7 @@ CPU::State FifoPlayer::AdvanceFrame()
   if (m_EarlyMemoryUpdates && m_CurrentFrame == m_FrameRangeStart)
     WriteAllMemoryUpdates();
 
-  WriteFrame(m_File->GetFrame(m_CurrentFrame), m_FrameInfo[m_CurrentFrame]);
+  WriteFrame(*m_File->GetFrame(m_CurrentFrame), m_FrameInfo[m_CurrentFrame]);
 
   ++m_CurrentFrame;
   return CPU::State::Running;
@@ -482,7 +487,8 @@ void FifoPlayer::WriteAllMemoryUpdates()
 
   for (u32 frameNum = 0; frameNum < m_File->GetFrameCount(); ++frameNum)
   {
-    const FifoFrameInfo& frame = m_File->GetFrame(frameNum);
+    const std::shared_ptr<const FifoFrameInfo> frame_data = m_File->GetFrame(frameNum);
+    const FifoFrameInfo& frame = *frame_data;
     for (auto& update : frame.memoryUpdates)
     {
       WriteMemory(update);
@@ -547,7 +553,8 @@ void FifoPlayer::SetupFifo()
   WriteCP(CommandProcessor::CTRL_REGISTER, 0);   // disable read, BP, interrupts
   WriteCP(CommandProcessor::CLEAR_REGISTER, 7);  // clear overflow, underflow, metrics
 
-  const FifoFrameInfo& frame = m_File->GetFrame(m_CurrentFrame);
+  const std::shared_ptr<const FifoFrameInfo> frame_data = m_File->GetFrame(m_CurrentFrame);
+  const FifoFrameInfo& frame = *frame_data;
 
   // Set fifo bounds
   WriteCP(CommandProcessor::FIFO_BASE_LO, frame.fifoStart);
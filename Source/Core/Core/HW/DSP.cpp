@@ -460,6 +460,9 @@ void DSPManager::Do_ARAM_DMA()
 
   m_dsp_control.DMAState = 1;
 
+  // The DSP accesses ARAM through its accelerator, so it has to be caught up before ARAM changes
+  m_dsp_emulator->DSP_Sync();
+
   // ARAM DMA transfer rate has been measured on real hw
   int ticksToTransfer = (m_aram_dma.Cnt.count / 32) * 246;
   core_timing.ScheduleEvent(ticksToTransfer, m_event_type_complete_aram);
@@ -0,0 +1,276 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/HW/DSPHLE/UCodes/AXMix.h"
+
+#include <algorithm>
+
+#include "Common/CPUDetect.h"
+#include "Common/Intrinsics.h"
+
+#ifdef _M_ARM_64
+#include <arm_neon.h>
+#endif
+
+// All of these work on 32-bit lanes: the product of a 16-bit sample and a signed or unsigned
+// 16-bit volume always fits, so there's no need for the 64-bit math of the scalar version.
+// The volume ramp is kept in 32-bit lanes as well, of which only the low 16 bits are used.
+
+namespace DSP::HLE
+{
+namespace
+{
+s16 ClampS16(s32 sample)
+{
+  return static_cast<s16>(std::clamp<s32>(sample, -0x8000, 0x7FFF));
+}
+
+s32 VolumeToS32(u16 volume, bool signed_volume)
+{
+  return signed_volume ? s32(s16(volume)) : s32(volume);
+}
+
+u16 ApplyVolumeRampScalar(s16* samples, u32 count, u16 volume, u16 volume_delta,
+                          bool signed_volume)
+{
+  for (u32 i = 0; i < count; ++i)
+  {
+    samples[i] = ClampS16((s32(samples[i]) * VolumeToS32(volume, signed_volume)) >> 15);
+    volume += volume_delta;
+  }
+  return volume;
+}
+
+u16 MixAddWithRampScalar(int* out, const s16* input, u32 count, u16 volume, u16 volume_delta,
+                         s16* last_sample)
+{
+  for (u32 i = 0; i < count; ++i)
+  {
+    const s16 sample = ClampS16((s32(input[i]) * s32(volume)) >> 15);
+    out[i] += sample;
+    volume += volume_delta;
+    *last_sample = sample;
+  }
+  return volume;
+}
+
+#ifdef _M_X86_64
+template <bool signed_volume>
+FUNCTION_TARGET_SSR41 __m128i ScaleSSE41(__m128i samples, __m128i volumes)
+{
+  const __m128i volume = signed_volume ? _mm_srai_epi32(_mm_slli_epi32(volumes, 16), 16) :
+                                         _mm_and_si128(volumes, _mm_set1_epi32(0xFFFF));
+  const __m128i product = _mm_srai_epi32(_mm_mullo_epi32(samples, volume), 15);
+  return _mm_min_epi32(_mm_max_epi32(product, _mm_set1_epi32(-0x8000)), _mm_set1_epi32(0x7FFF));
+}
+
+FUNCTION_TARGET_SSR41 __m128i InitialVolumesSSE41(u16 volume, u16 volume_delta)
+{
+  return _mm_add_epi32(_mm_set1_epi32(volume),
+                       _mm_mullo_epi32(_mm_setr_epi32(0, 1, 2, 3), _mm_set1_epi32(volume_delta)));
+}
+
+template <bool signed_volume>
+FUNCTION_TARGET_SSR41 u32 ApplyVolumeRampSSE41(s16* samples, u32 count, u16 volume,
+                                               u16 volume_delta)
+{
+  __m128i volumes = InitialVolumesSSE41(volume, volume_delta);
+  const __m128i step = _mm_set1_epi32(4 * volume_delta);
+
+  u32 i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    __m128i* ptr = reinterpret_cast<__m128i*>(samples + i);
+    const __m128i result =
+        ScaleSSE41<signed_volume>(_mm_cvtepi16_epi32(_mm_loadl_epi64(ptr)), volumes);
+    _mm_storel_epi64(ptr, _mm_packs_epi32(result, result));
+    volumes = _mm_add_epi32(volumes, step);
+  }
+  return i;
+}
+
+FUNCTION_TARGET_SSR41 u32 MixAddWithRampSSE41(int* out, const s16* input, u32 count, u16 volume,
+                                              u16 volume_delta, s16* last_sample)
+{
+  __m128i volumes = InitialVolumesSSE41(volume, volume_delta);
+  const __m128i step = _mm_set1_epi32(4 * volume_delta);
+
+  u32 i = 0;
+  __m128i result = _mm_setzero_si128();
+  for (; i + 4 <= count; i += 4)
+  {
+    const __m128i samples =
+        _mm_cvtepi16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(input + i)));
+    result = ScaleSSE41<false>(samples, volumes);
+
+    __m128i* ptr = reinterpret_cast<__m128i*>(out + i);
+    _mm_storeu_si128(ptr, _mm_add_epi32(_mm_loadu_si128(ptr), result));
+    volumes = _mm_add_epi32(volumes, step);
+  }
+
+  if (i != 0)
+    *last_sample = static_cast<s16>(_mm_extract_epi32(result, 3));
+  return i;
+}
+
+template <bool signed_volume>
+FUNCTION_TARGET_AVX2 __m256i ScaleAVX2(__m256i samples, __m256i volumes)
+{
+  const __m256i volume = signed_volume ?
+                             _mm256_srai_epi32(_mm256_slli_epi32(volumes, 16), 16) :
+                             _mm256_and_si256(volumes, _mm256_set1_epi32(0xFFFF));
+  const __m256i product = _mm256_srai_epi32(_mm256_mullo_epi32(samples, volume), 15);
+  return _mm256_min_epi32(_mm256_max_epi32(product, _mm256_set1_epi32(-0x8000)),
+                          _mm256_set1_epi32(0x7FFF));
+}
+
+FUNCTION_TARGET_AVX2 __m256i InitialVolumesAVX2(u16 volume, u16 volume_delta)
+{
+  return _mm256_add_epi32(_mm256_set1_epi32(volume),
+                          _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7),
+                                             _mm256_set1_epi32(volume_delta)));
+}
+
+template <bool signed_volume>
+FUNCTION_TARGET_AVX2 u32 ApplyVolumeRampAVX2(s16* samples, u32 count, u16 volume,
+                                             u16 volume_delta)
+{
+  __m256i volumes = InitialVolumesAVX2(volume, volume_delta);
+  const __m256i step = _mm256_set1_epi32(8 * volume_delta);
+
+  u32 i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    __m128i* ptr = reinterpret_cast<__m128i*>(samples + i);
+    const __m256i result =
+        ScaleAVX2<signed_volume>(_mm256_cvtepi16_epi32(_mm_loadu_si128(ptr)), volumes);
+    // Packing works within each 128-bit half, so the halves need to be put back together
+    const __m256i packed =
+        _mm256_permute4x64_epi64(_mm256_packs_epi32(result, result), _MM_SHUFFLE(3, 1, 2, 0));
+    _mm_storeu_si128(ptr, _mm256_castsi256_si128(packed));
+    volumes = _mm256_add_epi32(volumes, step);
+  }
+  return i;
+}
+
+FUNCTION_TARGET_AVX2 u32 MixAddWithRampAVX2(int* out, const s16* input, u32 count, u16 volume,
+                                            u16 volume_delta, s16* last_sample)
+{
+  __m256i volumes = InitialVolumesAVX2(volume, volume_delta);
+  const __m256i step = _mm256_set1_epi32(8 * volume_delta);
+
+  u32 i = 0;
+  __m256i result = _mm256_setzero_si256();
+  for (; i + 8 <= count; i += 8)
+  {
+    const __m256i samples =
+        _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i)));
+    result = ScaleAVX2<false>(samples, volumes);
+
+    __m256i* ptr = reinterpret_cast<__m256i*>(out + i);
+    _mm256_storeu_si256(ptr, _mm256_add_epi32(_mm256_loadu_si256(ptr), result));
+    volumes = _mm256_add_epi32(volumes, step);
+  }
+
+  if (i != 0)
+    *last_sample = static_cast<s16>(_mm256_extract_epi32(result, 7));
+  return i;
+}
+#endif
+
+#ifdef _M_ARM_64
+template <bool signed_volume>
+int16x4_t ScaleNEON(int16x4_t samples, int32x4_t volumes)
+{
+  const int32x4_t volume = signed_volume ? vshrq_n_s32(vshlq_n_s32(volumes, 16), 16) :
+                                           vandq_s32(volumes, vdupq_n_s32(0xFFFF));
+  // The saturating narrow does the clamping
+  return vqmovn_s32(vshrq_n_s32(vmulq_s32(vmovl_s16(samples), volume), 15));
+}
+
+int32x4_t InitialVolumesNEON(u16 volume, u16 volume_delta)
+{
+  static constexpr s32 lanes[4] = {0, 1, 2, 3};
+  return vmlaq_n_s32(vdupq_n_s32(volume), vld1q_s32(lanes), volume_delta);
+}
+
+template <bool signed_volume>
+u32 ApplyVolumeRampNEON(s16* samples, u32 count, u16 volume, u16 volume_delta)
+{
+  int32x4_t volumes = InitialVolumesNEON(volume, volume_delta);
+  const int32x4_t step = vdupq_n_s32(4 * volume_delta);
+
+  u32 i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    vst1_s16(samples + i, ScaleNEON<signed_volume>(vld1_s16(samples + i), volumes));
+    volumes = vaddq_s32(volumes, step);
+  }
+  return i;
+}
+
+u32 MixAddWithRampNEON(int* out, const s16* input, u32 count, u16 volume, u16 volume_delta,
+                       s16* last_sample)
+{
+  int32x4_t volumes = InitialVolumesNEON(volume, volume_delta);
+  const int32x4_t step = vdupq_n_s32(4 * volume_delta);
+
+  u32 i = 0;
+  int16x4_t result = vdup_n_s16(0);
+  for (; i + 4 <= count; i += 4)
+  {
+    result = ScaleNEON<false>(vld1_s16(input + i), volumes);
+
+    s32* ptr = reinterpret_cast<s32*>(out + i);
+    vst1q_s32(ptr, vaddw_s16(vld1q_s32(ptr), result));
+    volumes = vaddq_s32(volumes, step);
+  }
+
+  if (i != 0)
+    *last_sample = vget_lane_s16(result, 3);
+  return i;
+}
+#endif
+}  // namespace
+
+u16 ApplyVolumeRamp(s16* samples, u32 count, u16 volume, u16 volume_delta, bool signed_volume)
+{
+  u32 done = 0;
+#if defined(_M_X86_64)
+  if (cpu_info.bAVX2)
+  {
+    done = signed_volume ? ApplyVolumeRampAVX2<true>(samples, count, volume, volume_delta) :
+                           ApplyVolumeRampAVX2<false>(samples, count, volume, volume_delta);
+  }
+  else if (cpu_info.bSSE4_1)
+  {
+    done = signed_volume ? ApplyVolumeRampSSE41<true>(samples, count, volume, volume_delta) :
+                           ApplyVolumeRampSSE41<false>(samples, count, volume, volume_delta);
+  }
+#elif defined(_M_ARM_64)
+  done = signed_volume ? ApplyVolumeRampNEON<true>(samples, count, volume, volume_delta) :
+                         ApplyVolumeRampNEON<false>(samples, count, volume, volume_delta);
+#endif
+
+  volume += static_cast<u16>(done * volume_delta);
+  return ApplyVolumeRampScalar(samples + done, count - done, volume, volume_delta, signed_volume);
+}
+
+u16 MixAddWithRamp(int* out, const s16* input, u32 count, u16 volume, u16 volume_delta,
+                   s16* last_sample)
+{
+  u32 done = 0;
+#if defined(_M_X86_64)
+  if (cpu_info.bAVX2)
+    done = MixAddWithRampAVX2(out, input, count, volume, volume_delta, last_sample);
+  else if (cpu_info.bSSE4_1)
+    done = MixAddWithRampSSE41(out, input, count, volume, volume_delta, last_sample);
+#elif defined(_M_ARM_64)
+  done = MixAddWithRampNEON(out, input, count, volume, volume_delta, last_sample);
+#endif
+
+  volume += static_cast<u16>(done * volume_delta);
+  return MixAddWithRampScalar(out + done, input + done, count - done, volume, volume_delta,
+                              last_sample);
+}
+}  // namespace DSP::HLE
@@ -0,0 +1,23 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "Common/CommonTypes.h"
+
+// Vectorized sample loops shared by AX GC and AX Wii. They give exactly the same results as
+// processing one sample at a time.
+
+namespace DSP::HLE
+{
+// samples[i] = clamp((samples[i] * volume) >> 15), where the volume is incremented by volume_delta
+// (wrapping around) after every sample. The volume is signed if signed_volume is set, and unsigned
+// otherwise. Returns the volume after the last sample.
+u16 ApplyVolumeRamp(s16* samples, u32 count, u16 volume, u16 volume_delta, bool signed_volume);
+
+// out[i] += clamp((input[i] * volume) >> 15) with an unsigned volume that is ramped like above.
+// Returns the volume after the last sample. If count isn't 0, the last sample that was added is
+// stored in last_sample.
+u16 MixAddWithRamp(int* out, const s16* input, u32 count, u16 volume, u16 volume_delta,
+                   s16* last_sample);
+}  // namespace DSP::HLE
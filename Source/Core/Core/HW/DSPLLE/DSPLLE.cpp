@@ -30,6 +30,11 @@
 
 namespace DSP::LLE
 {
+// How many DSP cycles the DSP thread may lag behind before DSP_Update blocks the CPU thread.
+// This is about four regular update periods. Mailbox reads and ARAM DMAs still wait for the DSP
+// thread to catch up completely, as that's where the CPU can observe the DSP's progress.
+constexpr u32 MAX_PENDING_DSP_CYCLES = 8400;
+
 DSPLLE::DSPLLE() = default;
 
 DSPLLE::~DSPLLE()
@@ -60,7 +65,7 @@ void DSPLLE::DSPThread(DSPLLE* dsp_lle)
 
   while (dsp_lle->m_is_running.IsSet())
   {
-    const int cycles = static_cast<int>(dsp_lle->m_cycle_count.load());
+    const u32 cycles = dsp_lle->m_cycle_count.load();
     if (cycles > 0)
     {
       std::unique_lock dsp_thread_lock(dsp_lle->m_dsp_thread_mutex, std::try_to_lock);
@@ -68,13 +73,15 @@ void DSPLLE::DSPThread(DSPLLE* dsp_lle)
       {
         if (dsp_lle->m_dsp_core.IsJITCreated())
         {
-          dsp_lle->m_dsp_core.RunCycles(cycles);
+          dsp_lle->m_dsp_core.RunCycles(static_cast<int>(cycles));
         }
         else
         {
-          dsp_lle->m_dsp_core.GetInterpreter().RunCyclesThread(cycles);
+          dsp_lle->m_dsp_core.GetInterpreter().RunCyclesThread(static_cast<int>(cycles));
         }
-        dsp_lle->m_cycle_count.store(0);
+        // The CPU thread may have handed out more cycles in the meantime
+        dsp_lle->m_cycle_count.fetch_sub(cycles);
+        dsp_lle->m_ppc_event.Set();
         continue;
       }
     }
@@ -212,11 +219,13 @@ u16 DSPLLE::DSP_ReadControlRegister()
 
 u16 DSPLLE::DSP_ReadMailBoxHigh(bool cpu_mailbox)
 {
+  DSP_Sync();
   return m_dsp_core.ReadMailboxHigh(cpu_mailbox ? Mailbox::CPU : Mailbox::DSP);
 }
 
 u16 DSPLLE::DSP_ReadMailBoxLow(bool cpu_mailbox)
 {
+  DSP_Sync();
   return m_dsp_core.ReadMailboxLow(cpu_mailbox ? Mailbox::CPU : Mailbox::DSP);
 }
 
@@ -261,9 +270,13 @@ void DSPLLE::DSP_Update(int cycles)
   {
     if (m_request_disable_thread || Core::WantsDeterminism())
     {
+      // Let the DSP thread finish the cycles it was given before it's stopped, so that the core
+      // is never run on both threads at once.
+      WaitForDSPThread(0);
       DSP_StopSoundStream();
       m_is_dsp_on_thread = false;
       m_request_disable_thread = false;
+      m_cycle_count.store(0);
       Config::SetBaseOrCurrent(Config::MAIN_DSP_THREAD, false);
     }
   }
@@ -276,13 +289,26 @@ void DSPLLE::DSP_Update(int cycles)
   }
   else
   {
-    // Wait for DSP thread to complete its cycle. Note: this logic should be thought through.
-    m_ppc_event.Wait();
     m_cycle_count.fetch_add(dsp_cycles);
     m_dsp_event.Set();
+    WaitForDSPThread(MAX_PENDING_DSP_CYCLES);
   }
 }
 
+void DSPLLE::DSP_Sync()
+{
+  if (m_is_dsp_on_thread)
+    WaitForDSPThread(0);
+}
+
+void DSPLLE::WaitForDSPThread(u32 max_pending_cycles)
+{
+  // The DSP thread signals m_ppc_event whenever it has run a batch of cycles or goes idle.
+  // It can't make any progress while PauseAndLock is holding it.
+  while (m_cycle_count.load() > max_pending_cycles && m_is_running.IsSet() && !m_is_paused.IsSet())
+    m_ppc_event.Wait();
+}
+
 u32 DSPLLE::DSP_UpdateRate()
 {
   return 12600;  // TO BE TWEAKED
@@ -293,15 +319,18 @@ void DSPLLE::PauseAndLock(bool do_lock)
   if (do_lock)
   {
     m_dsp_thread_mutex.lock();
+    m_is_paused.Set();
+    // Wake up WaitForDSPThread, as the DSP thread won't signal it until we unlock
+    m_ppc_event.Set();
   }
   else
   {
+    m_is_paused.Clear();
     m_dsp_thread_mutex.unlock();
 
     if (m_is_dsp_on_thread)
     {
       // Signal the DSP thread so it can perform any outstanding work now (if any)
-      m_ppc_event.Wait();
       m_dsp_event.Set();
     }
   }
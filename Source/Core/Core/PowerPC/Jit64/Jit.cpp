@@ -748,10 +748,10 @@ void Jit64::Trace()
 
 void Jit64::Jit(u32 em_address)
 {
-  Jit(em_address, true);
+  Jit(em_address, OutOfCodeSpace::EvictAndRetry);
 }
 
-void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
+void Jit64::Jit(u32 em_address, OutOfCodeSpace on_out_of_code_space)
 {
   CleanUpAfterStackFault();
 
@@ -839,16 +839,28 @@ void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
 #endif
       return;
     }
+
+    // The block's code may be incomplete, so drop it without touching its code.
+    blocks.EraseUnfinalizedBlock(*b);
   }
 
-  if (clear_cache_and_retry_on_failure)
+  switch (on_out_of_code_space)
   {
+  case OutOfCodeSpace::EvictAndRetry:
     // Code generation failed due to not enough free space in either the near or far code regions.
-    // Clear the entire JIT cache and retry.
+    // Evict the colder half of the JIT cache and retry.
+    WARN_LOG_FMT(DYNA_REC, "evicting cold blocks from code caches");
+    blocks.EvictColdBlocks();
+    Jit(em_address, OutOfCodeSpace::ClearAndRetry);
+    return;
+  case OutOfCodeSpace::ClearAndRetry:
+    // Evicting blocks didn't free up a large enough region. Clear the entire JIT cache and retry.
     WARN_LOG_FMT(DYNA_REC, "flushing code caches, please report if this happens a lot");
     ClearCache();
-    Jit(em_address, false);
+    Jit(em_address, OutOfCodeSpace::Fail);
     return;
+  case OutOfCodeSpace::Fail:
+    break;
   }
 
   PanicAlertFmtT("JIT failed to find code space after a cache clear. This should never happen. "
@@ -905,6 +917,10 @@ bool Jit64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
   if (IsProfilingEnabled())
     ABI_CallFunctionP(&JitBlock::ProfileData::BeginProfiling, b->profile_data.get());
 
+  // Keeps the block from being evicted the next time code space runs out
+  MOV(64, R(RSCRATCH), ImmPtr(&b->recently_used));
+  MOV(8, MatR(RSCRATCH), Imm8(1));
+
 #if defined(_DEBUG) || defined(DEBUGFAST) || defined(NAN_CHECK)
   // should help logged stack-traces become more accurate
   MOV(32, PPCSTATE(pc), Imm32(js.blockStart));
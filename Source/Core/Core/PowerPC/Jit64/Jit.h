@@ -63,7 +63,7 @@ public:
   // Jit!
 
   void Jit(u32 em_address) override;
-  void Jit(u32 em_address, bool clear_cache_and_retry_on_failure);
+  void Jit(u32 em_address, OutOfCodeSpace on_out_of_code_space);
   bool DoJit(u32 em_address, JitBlock* b, u32 nextPC);
 
   void EraseSingleBlock(const JitBlock& block) override;
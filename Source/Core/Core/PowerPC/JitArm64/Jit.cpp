@@ -939,10 +939,10 @@ void JitArm64::Trace()
 
 void JitArm64::Jit(u32 em_address)
 {
-  Jit(em_address, true);
+  Jit(em_address, OutOfCodeSpace::EvictAndRetry);
 }
 
-void JitArm64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
+void JitArm64::Jit(u32 em_address, OutOfCodeSpace on_out_of_code_space)
 {
   CleanUpAfterStackFault();
 
@@ -1030,16 +1030,31 @@ void JitArm64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
 #endif
       return;
     }
+
+    // The block's code may be incomplete, so drop it without touching its code. Also forget any
+    // fastmem handlers it registered, as the code region stays free and gets reused.
+    blocks.EraseUnfinalizedBlock(*b);
+    m_fault_to_handler.erase(m_fault_to_handler.upper_bound(near_start),
+                             m_fault_to_handler.upper_bound(GetWritableCodeEnd()));
   }
 
-  if (clear_cache_and_retry_on_failure)
+  switch (on_out_of_code_space)
   {
+  case OutOfCodeSpace::EvictAndRetry:
     // Code generation failed due to not enough free space in either the near or far code regions.
-    // Clear the entire JIT cache and retry.
+    // Evict the colder half of the JIT cache and retry.
+    WARN_LOG_FMT(DYNA_REC, "evicting cold blocks from code caches");
+    blocks.EvictColdBlocks();
+    Jit(em_address, OutOfCodeSpace::ClearAndRetry);
+    return;
+  case OutOfCodeSpace::ClearAndRetry:
+    // Evicting blocks didn't free up a large enough region. Clear the entire JIT cache and retry.
     WARN_LOG_FMT(DYNA_REC, "flushing code caches, please report if this happens a lot");
     ClearCache();
-    Jit(em_address, false);
+    Jit(em_address, OutOfCodeSpace::Fail);
     return;
+  case OutOfCodeSpace::Fail:
+    break;
   }
 
   PanicAlertFmtT("JIT failed to find code space after a cache clear. This should never happen. "
@@ -1142,6 +1157,11 @@ bool JitArm64::DoJit(u32 em_address, JitBlock* b, u32 nextPC)
   if (IsProfilingEnabled())
     ABI_CallFunction(&JitBlock::ProfileData::BeginProfiling, b->profile_data.get());
 
+  // Keeps the block from being evicted the next time code space runs out
+  MOVP2R(ARM64Reg::X0, &b->recently_used);
+  MOVI2R(ARM64Reg::W1, 1);
+  STRB(IndexType::Unsigned, ARM64Reg::W1, ARM64Reg::X0, 0);
+
   if (code_block.m_gqr_used.Count() == 1 && !js.pairedQuantizeAddresses.contains(js.blockStart))
   {
     int gqr = *code_block.m_gqr_used.begin();
@@ -48,7 +48,7 @@ public:
   void SingleStep() override;
 
   void Jit(u32 em_address) override;
-  void Jit(u32 em_address, bool clear_cache_and_retry_on_failure);
+  void Jit(u32 em_address, OutOfCodeSpace on_out_of_code_space);
 
   void EraseSingleBlock(const JitBlock& block) override;
   std::vector<MemoryStats> GetMemoryStats() const override;
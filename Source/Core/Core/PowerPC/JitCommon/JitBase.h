@@ -205,6 +205,17 @@ public:
 
   virtual void Jit(u32 em_address) = 0;
 
+  // What to do when a block doesn't fit into the free space left in the code caches.
+  enum class OutOfCodeSpace
+  {
+    // Evict the colder half of the compiled blocks and retry.
+    EvictAndRetry,
+    // Clear the entire cache and retry.
+    ClearAndRetry,
+    // Give up. This should never happen right after the cache was cleared.
+    Fail,
+  };
+
   virtual void EraseSingleBlock(const JitBlock& block) = 0;
 
   // Memory region name, free size, and fragmentation ratio
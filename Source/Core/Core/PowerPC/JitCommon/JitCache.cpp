@@ -9,11 +9,12 @@
 #include <functional>
 #include <map>
 #include <ranges>
-#include <set>
 #include <span>
 #include <utility>
+#include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/Contains.h"
 #include "Common/JitRegister.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/Core.h"
@@ -29,10 +30,22 @@
 
 using namespace Gen;
 
+// Removes the first occurrence of value from a duplicate-free, unordered vector.
+template <typename T>
+static void EraseUnordered(std::vector<T>& vector, const T& value)
+{
+  const auto it = std::ranges::find(vector, value);
+  if (it == vector.end())
+    return;
+
+  *it = vector.back();
+  vector.pop_back();
+}
+
 bool JitBlock::OverlapsPhysicalRange(u32 address, u32 length) const
 {
-  return physical_addresses.lower_bound(address) !=
-         physical_addresses.lower_bound(address + length);
+  return std::ranges::lower_bound(physical_addresses, address) !=
+         std::ranges::lower_bound(physical_addresses, address + length);
 }
 
 void JitBlock::ProfileData::BeginProfiling(ProfileData* data)
@@ -139,6 +152,7 @@ JitBlock* JitBaseBlockCache::AllocateBlock(u32 em_address)
   b.feature_flags = m_jit.m_ppc_state.feature_flags;
   b.linkData.clear();
   b.fast_block_map_index = 0;
+  b.allocation_index = m_next_allocation_index++;
   return &b;
 }
 
@@ -158,7 +172,8 @@ void JitBaseBlockCache::FinalizeBlock(JitBlock& block, bool block_link,
   }
   block.fast_block_map_index = index;
 
-  block.physical_addresses = code_block.m_physical_addresses;
+  block.physical_addresses.assign(code_block.m_physical_addresses.begin(),
+                                  code_block.m_physical_addresses.end());
 
   block.originalSize = code_block.m_num_instructions;
   if (m_jit.IsDebuggingEnabled())
@@ -174,14 +189,21 @@ void JitBaseBlockCache::FinalizeBlock(JitBlock& block, bool block_link,
   for (u32 addr : block.physical_addresses)
   {
     valid_block.Set(addr / 32);
-    block_range_map[addr & BLOCK_RANGE_MAP_MASK].insert(&block);
+
+    // physical_addresses is sorted, so this block was already added to the macro block if the
+    // previous address fell into the same one.
+    std::vector<JitBlock*>& macro_block_list = block_range_map[addr & BLOCK_RANGE_MAP_MASK];
+    if (macro_block_list.empty() || macro_block_list.back() != &block)
+      macro_block_list.push_back(&block);
   }
 
   if (block_link)
   {
     for (const auto& e : block.linkData)
     {
-      links_to[e.exitAddress].insert(&block);
+      std::vector<JitBlock*>& sources = links_to[e.exitAddress];
+      if (!Common::Contains(sources, &block))
+        sources.push_back(&block);
     }
 
     LinkBlock(block);
@@ -354,17 +376,18 @@ void JitBaseBlockCache::ErasePhysicalRange(u32 address, u32 length)
   while (start != end)
   {
     // Iterate over all blocks in the macro block.
-    auto iter = start->second.begin();
-    while (iter != start->second.end())
+    std::vector<JitBlock*>& macro_block_list = start->second;
+    size_t i = 0;
+    while (i < macro_block_list.size())
     {
-      JitBlock* block = *iter;
+      JitBlock* block = macro_block_list[i];
       if (block->OverlapsPhysicalRange(address, length))
       {
         // If the block overlaps, also remove all other occupied slots in the other macro blocks.
         // This will leak empty macro blocks, but they may be reused or cleared later on.
         for (u32 addr : block->physical_addresses)
           if ((addr & BLOCK_RANGE_MAP_MASK) != start->first)
-            block_range_map[addr & BLOCK_RANGE_MAP_MASK].erase(block);
+            EraseUnordered(block_range_map[addr & BLOCK_RANGE_MAP_MASK], block);
 
         // And remove the block.
         DestroyBlock(*block);
@@ -378,11 +401,12 @@ void JitBaseBlockCache::ErasePhysicalRange(u32 address, u32 length)
           }
           block_map_iter.first++;
         }
-        iter = start->second.erase(iter);
+        macro_block_list[i] = macro_block_list.back();
+        macro_block_list.pop_back();
       }
       else
       {
-        iter++;
+        i++;
       }
     }
 
@@ -405,12 +429,54 @@ void JitBaseBlockCache::EraseSingleBlock(const JitBlock& block)
   JitBlock& mutable_block = block_map_iter->second;
 
   for (const u32 addr : mutable_block.physical_addresses)
-    block_range_map[addr & BLOCK_RANGE_MAP_MASK].erase(&mutable_block);
+    EraseUnordered(block_range_map[addr & BLOCK_RANGE_MAP_MASK], &mutable_block);
 
   DestroyBlock(mutable_block);
   block_map.erase(block_map_iter);  // The original JitBlock reference is now dangling.
 }
 
+void JitBaseBlockCache::EraseUnfinalizedBlock(const JitBlock& block)
+{
+  const auto equal_range = block_map.equal_range(block.physicalAddress);
+  const auto block_map_iter = std::ranges::find(equal_range.first, equal_range.second, &block,
+                                                [](const auto& kv) { return &kv.second; });
+  if (block_map_iter == equal_range.second) [[unlikely]]
+    return;
+
+  // The block was never added to the fast block map, block_range_map or links_to.
+  block_map.erase(block_map_iter);
+}
+
+void JitBaseBlockCache::EvictColdBlocks()
+{
+  std::vector<JitBlock*> blocks;
+  blocks.reserve(block_map.size());
+  for (auto& [physical_address, block] : block_map)
+    blocks.push_back(&block);
+
+  const auto run_count = [](const JitBlock* block) -> std::size_t {
+    return block->profile_data ? block->profile_data->run_count : 0;
+  };
+  const auto colder = [&run_count](const JitBlock* a, const JitBlock* b) {
+    if (a->recently_used != b->recently_used)
+      return a->recently_used < b->recently_used;
+    const std::size_t a_run_count = run_count(a);
+    const std::size_t b_run_count = run_count(b);
+    if (a_run_count != b_run_count)
+      return a_run_count < b_run_count;
+    return a->allocation_index < b->allocation_index;
+  };
+
+  const auto middle = blocks.begin() + blocks.size() / 2;
+  std::ranges::nth_element(blocks, middle, colder);
+  for (auto it = blocks.begin(); it != middle; ++it)
+    EraseSingleBlock(**it);
+  for (auto it = middle; it != blocks.end(); ++it)
+    (*it)->recently_used = 0;
+
+  Host_JitCacheInvalidation();
+}
+
 u32* JitBaseBlockCache::GetBlockBitSet() const
 {
   return valid_block.m_valid_block.get();
@@ -509,7 +575,7 @@ void JitBaseBlockCache::DestroyBlock(JitBlock& block)
     auto it = links_to.find(e.exitAddress);
     if (it == links_to.end())
       continue;
-    it->second.erase(&block);
+    EraseUnordered(it->second, &block);
     if (it->second.empty())
       links_to.erase(it);
   }
@@ -10,10 +10,8 @@
 #include <functional>
 #include <map>
 #include <memory>
-#include <set>
 #include <type_traits>
 #include <unordered_map>
-#include <unordered_set>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -100,14 +98,22 @@ struct JitBlock : public JitBlockData
   };
   std::vector<LinkData> linkData;
 
-  // This set stores all physical addresses of all occupied instructions.
-  std::set<u32> physical_addresses;
+  // Sorted, duplicate-free list of the physical addresses of all occupied instructions.
+  std::vector<u32> physical_addresses;
 
   // This is only available when debugging is enabled. It is a trimmed-down copy of the
   // PPCAnalyst::CodeBuffer used to recompile this block, including repeat instructions.
   std::vector<std::pair<u32, UGeckoInstruction>> original_buffer;
 
   std::unique_ptr<ProfileData> profile_data;
+
+  // Set to 1 by the block's own code every time it runs, and reset for all blocks whenever cold
+  // blocks are evicted. Blocks that haven't run since the previous eviction are evicted first.
+  u8 recently_used = 0;
+
+  // Increasing number assigned when the block is allocated. Among blocks that are equally cold,
+  // the oldest ones are evicted first.
+  u64 allocation_index = 0;
 };
 
 typedef void (*CompiledCode)();
@@ -185,6 +191,14 @@ public:
   void InvalidateICacheLine(u32 address);
   void ErasePhysicalRange(u32 address, u32 length);
   void EraseSingleBlock(const JitBlock& block);
+  // Removes a block whose code generation failed before FinalizeBlock was called. Unlike
+  // EraseSingleBlock, this doesn't write to the block's code, which may be incomplete.
+  void EraseUnfinalizedBlock(const JitBlock& block);
+
+  // Erases the colder half of all blocks to make room in the code caches without throwing away
+  // the entire cache. Blocks that haven't run since the previous eviction go first, then blocks
+  // that ran the fewest times according to their profiling data (if enabled), then the oldest.
+  void EvictColdBlocks();
 
   u32* GetBlockBitSet() const;
 
@@ -208,18 +222,21 @@ private:
   size_t FastLookupIndexForAddress(u32 address, u32 msr);
 
   // links_to hold all exit points of all valid blocks in a reverse way.
-  // It is used to query all blocks which links to an address.
-  std::unordered_map<u32, std::unordered_set<JitBlock*>> links_to;  // destination_PC -> number
+  // It is used to query all blocks which links to an address. Each list is duplicate-free.
+  std::unordered_map<u32, std::vector<JitBlock*>> links_to;  // destination_PC -> blocks
 
   // Map indexed by the physical address of the entry point.
   // This is used to query the block based on the current PC in a slow way.
-  std::multimap<u32, JitBlock> block_map;  // start_addr -> block
+  // Nodes are never moved, so pointers to the blocks stay valid until they are erased.
+  std::unordered_multimap<u32, JitBlock> block_map;  // start_addr -> block
 
   // Range of overlapping code indexed by a masked physical address.
   // This is used for invalidation of memory regions. The range is grouped
-  // in macro blocks of each 0x100 bytes.
+  // in macro blocks of each 0x100 bytes. Each list is duplicate-free.
   static constexpr u32 BLOCK_RANGE_MAP_MASK = ~(0x100 - 1);
-  std::map<u32, std::unordered_set<JitBlock*>> block_range_map;
+  std::map<u32, std::vector<JitBlock*>> block_range_map;
+
+  u64 m_next_allocation_index = 0;
 
   // This bitsets shows which cachelines overlap with any blocks.
   // It is used to provide a fast way to query if no icache invalidation is needed.
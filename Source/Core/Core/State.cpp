@@ -5,12 +5,16 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <deque>
 #include <filesystem>
+#include <future>
 #include <locale>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <thread>
 #include <utility>
@@ -21,13 +25,16 @@
 
 #include <lz4.h>
 #include <lzo/lzo1x.h>
+#include <zstd.h>
 
+#include "Common/BinaryDelta.h"
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/Contains.h"
 #include "Common/Event.h"
 #include "Common/FileUtil.h"
 #include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 #include "Common/Thread.h"
 #include "Common/TimeUtil.h"
@@ -37,6 +44,7 @@
 
 #include "Core/AchievementManager.h"
 #include "Core/Config/AchievementSettings.h"
+#include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
@@ -98,12 +106,38 @@ static std::mutex s_state_writes_in_queue_mutex;
 static size_t s_state_writes_in_queue;
 static std::condition_variable s_state_write_queue_is_empty;
 
+struct RewindEntry
+{
+  // LZ4 compressed delta that turns the next newer state back into this one
+  std::vector<u8> compressed_delta;
+  int delta_size;
+};
+
+// Protects the rewind buffer against the CPU thread and the rewind worker.
+static std::mutex s_rewind_mutex;
+static std::deque<RewindEntry> s_rewind_entries;
+static std::vector<u8> s_rewind_latest_state;
+static size_t s_rewind_memory_usage = 0;
+static RewindStats s_rewind_stats;
+
+// Only accessed by the CPU thread
+static u32 s_rewind_frame_counter = 0;
+
+// Set while a capture is waiting to be compressed, so that a slow worker never causes captures to
+// pile up in memory.
+static std::atomic<bool> s_rewind_capture_pending = false;
+
+static Common::WorkQueueThread<std::vector<u8>> s_rewind_thread;
+
 // Don't forget to increase this after doing changes on the savestate system
 constexpr u32 STATE_VERSION = 169;  // Last changed in PR 13074
 
 // Increase this if the StateExtendedHeader definition changes
 constexpr u32 EXTENDED_HEADER_VERSION = 1;  // Last changed in PR 12217
 
+// Size of the independently compressed chunks of ChunkedLZ4 and ChunkedZstd states
+constexpr u32 STATE_CHUNK_SIZE = 4 * 1024 * 1024;
+
 // Change this if we ever need to store more data in the extended header
 constexpr u32 COMPRESSED_DATA_OFFSET = 0;
 
@@ -317,51 +351,107 @@ static bool CompareTimestamp(const SlotWithTimestamp& lhs, const SlotWithTimesta
   return lhs.timestamp < rhs.timestamp;
 }
 
-static void CompressBufferToFile(const u8* raw_buffer, u64 size, File::IOFile& f)
+// Splits the chunks evenly between as many threads as the host has cores.
+template <typename Function>
+static void ForEachChunkInParallel(size_t num_chunks, const Function& function)
 {
-  u64 total_bytes_compressed = 0;
+  const size_t threads =
+      std::min<size_t>(num_chunks, std::max(1u, std::thread::hardware_concurrency()));
 
-  while (true)
+  std::vector<std::future<void>> futures(threads);
+  for (size_t i = 0; i < threads; ++i)
   {
-    u64 bytes_left_to_compress = size - total_bytes_compressed;
+    futures[i] = std::async(
+        std::launch::async,
+        [&function](size_t start, size_t end) {
+          for (size_t j = start; j < end; ++j)
+            function(j);
+        },
+        i * num_chunks / threads, (i + 1) * num_chunks / threads);
+  }
 
-    int bytes_to_compress =
-        static_cast<int>(std::min(static_cast<u64>(LZ4_MAX_INPUT_SIZE), bytes_left_to_compress));
-    int compressed_buffer_size = LZ4_compressBound(bytes_to_compress);
-    auto compressed_buffer = std::make_unique<char[]>(compressed_buffer_size);
-    s32 compressed_len =
-        LZ4_compress_default(reinterpret_cast<const char*>(raw_buffer) + total_bytes_compressed,
-                             compressed_buffer.get(), bytes_to_compress, compressed_buffer_size);
+  for (std::future<void>& future : futures)
+    future.get();
+}
+
+static bool CompressBufferToFile(const u8* raw_buffer, u64 size, CompressionType compression_type,
+                                 File::IOFile& f)
+{
+  const u32 num_chunks = static_cast<u32>((size + STATE_CHUNK_SIZE - 1) / STATE_CHUNK_SIZE);
+  const int zstd_level =
+      std::clamp(Config::Get(Config::MAIN_SAVESTATE_ZSTD_LEVEL), 1, ZSTD_maxCLevel());
+
+  std::vector<std::vector<u8>> compressed_chunks(num_chunks);
+  std::atomic<bool> success = true;
+
+  ForEachChunkInParallel(num_chunks, [&](size_t i) {
+    const u8* chunk = raw_buffer + i * STATE_CHUNK_SIZE;
+    const size_t chunk_size =
+        static_cast<size_t>(std::min<u64>(STATE_CHUNK_SIZE, size - i * STATE_CHUNK_SIZE));
+    std::vector<u8>& compressed = compressed_chunks[i];
 
-    if (compressed_len == 0)
+    if (compression_type == CompressionType::ChunkedZstd)
     {
-      PanicAlertFmtT("Internal LZ4 Error - compression failed");
-      break;
+      compressed.resize(ZSTD_compressBound(chunk_size));
+      const size_t compressed_size =
+          ZSTD_compress(compressed.data(), compressed.size(), chunk, chunk_size, zstd_level);
+      if (ZSTD_isError(compressed_size))
+        success = false;
+      else
+        compressed.resize(compressed_size);
+    }
+    else
+    {
+      compressed.resize(LZ4_compressBound(static_cast<int>(chunk_size)));
+      const int compressed_size = LZ4_compress_default(
+          reinterpret_cast<const char*>(chunk), reinterpret_cast<char*>(compressed.data()),
+          static_cast<int>(chunk_size), static_cast<int>(compressed.size()));
+      if (compressed_size <= 0)
+        success = false;
+      else
+        compressed.resize(compressed_size);
     }
+  });
 
-    // The size of the data to write is 'compressed_len'
-    f.WriteArray(&compressed_len, 1);
-    f.WriteBytes(compressed_buffer.get(), compressed_len);
+  if (!success)
+    return false;
 
-    total_bytes_compressed += bytes_to_compress;
-    if (total_bytes_compressed == size)
-      break;
-  }
+  std::vector<u32> compressed_sizes(num_chunks);
+  for (u32 i = 0; i < num_chunks; ++i)
+    compressed_sizes[i] = static_cast<u32>(compressed_chunks[i].size());
+
+  f.WriteArray(&STATE_CHUNK_SIZE, 1);
+  f.WriteArray(&num_chunks, 1);
+  f.WriteArray(compressed_sizes.data(), num_chunks);
+  for (const std::vector<u8>& compressed : compressed_chunks)
+    f.WriteBytes(compressed.data(), compressed.size());
+
+  return true;
 }
 
-static void CreateExtendedHeader(StateExtendedHeader& extended_header, size_t uncompressed_size)
+static CompressionType GetCompressionType()
+{
+  if (!s_use_compression)
+    return CompressionType::Uncompressed;
+
+  return Config::Get(Config::MAIN_SAVESTATE_ZSTD_LEVEL) > 0 ? CompressionType::ChunkedZstd :
+                                                              CompressionType::ChunkedLZ4;
+}
+
+static void CreateExtendedHeader(StateExtendedHeader& extended_header,
+                                 CompressionType compression_type, size_t uncompressed_size)
 {
   StateExtendedBaseHeader& base_header = extended_header.base_header;
   base_header.header_version = EXTENDED_HEADER_VERSION;
-  base_header.compression_type =
-      s_use_compression ? CompressionType::LZ4 : CompressionType::Uncompressed;
+  base_header.compression_type = compression_type;
   base_header.payload_offset = COMPRESSED_DATA_OFFSET;
   base_header.uncompressed_size = uncompressed_size;
 
   // If more fields are added to StateExtendedHeader, set them here.
 }
 
-static void WriteHeadersToFile(size_t uncompressed_size, File::IOFile& f)
+static void WriteHeadersToFile(CompressionType compression_type, size_t uncompressed_size,
+                               File::IOFile& f)
 {
   StateHeader header{};
   SConfig::GetInstance().GetGameID().copy(header.legacy_header.game_id,
@@ -373,7 +463,7 @@ static void WriteHeadersToFile(size_t uncompressed_size, File::IOFile& f)
   header.version_header.version_string_length = static_cast<u32>(header.version_string.length());
 
   StateExtendedHeader extended_header{};
-  CreateExtendedHeader(extended_header, uncompressed_size);
+  CreateExtendedHeader(extended_header, compression_type, uncompressed_size);
 
   f.WriteArray(&header.legacy_header, 1);
   f.WriteArray(&header.version_header, 1);
@@ -407,15 +497,23 @@ static void CompressAndDumpState(Core::System& system, CompressAndDumpState_args
     return;
   }
 
-  WriteHeadersToFile(buffer_size, f);
+  const CompressionType compression_type = GetCompressionType();
+  WriteHeadersToFile(compression_type, buffer_size, f);
 
-  if (s_use_compression)
-    CompressBufferToFile(buffer_data, buffer_size, f);
+  bool written;
+  if (compression_type != CompressionType::Uncompressed)
+    written = CompressBufferToFile(buffer_data, buffer_size, compression_type, f);
   else
-    f.WriteBytes(buffer_data, buffer_size);
+    written = f.WriteBytes(buffer_data, buffer_size);
 
-  if (!f.IsGood())
-    Core::DisplayMessage("Failed to write state file", 2000);
+  // Don't let an incomplete file replace the existing state
+  if (!written || !f.IsGood())
+  {
+    Core::DisplayMessage(written ? "Failed to write state file" : "Failed to compress state", 2000);
+    f.Close();
+    File::Delete(temp_filename);
+    return;
+  }
 
   const std::string last_state_filename = File::GetUserPath(D_STATESAVES_IDX) + "lastState.sav";
   const std::string last_state_dtmname = last_state_filename + ".dtm";
@@ -722,6 +820,82 @@ static bool DecompressLZ4(std::vector<u8>& raw_buffer, u64 size, File::IOFile& f
   }
 }
 
+static bool DecompressChunks(std::vector<u8>& raw_buffer, u64 size,
+                             CompressionType compression_type, File::IOFile& f)
+{
+  u32 chunk_size;
+  u32 num_chunks;
+  if (!f.ReadArray(&chunk_size, 1) || !f.ReadArray(&num_chunks, 1))
+  {
+    PanicAlertFmt("Could not read state chunk table");
+    return false;
+  }
+
+  if (chunk_size == 0 || num_chunks != (size + chunk_size - 1) / chunk_size)
+  {
+    PanicAlertFmt("State chunk table corrupted ({0} chunks of {1} bytes for {2} bytes)",
+                  num_chunks, chunk_size, size);
+    return false;
+  }
+
+  std::vector<u32> compressed_sizes(num_chunks);
+  if (!f.ReadArray(compressed_sizes.data(), num_chunks))
+  {
+    PanicAlertFmt("Could not read state chunk table");
+    return false;
+  }
+
+  std::vector<u64> compressed_offsets(num_chunks);
+  u64 total_compressed_size = 0;
+  for (u32 i = 0; i < num_chunks; ++i)
+  {
+    compressed_offsets[i] = total_compressed_size;
+    total_compressed_size += compressed_sizes[i];
+  }
+
+  std::vector<u8> compressed_data(total_compressed_size);
+  if (!f.ReadBytes(compressed_data.data(), compressed_data.size()))
+  {
+    PanicAlertFmt("Could not read state data");
+    return false;
+  }
+
+  // Every chunk decompresses straight into its final place in the buffer
+  raw_buffer.resize(size);
+  std::atomic<bool> success = true;
+
+  ForEachChunkInParallel(num_chunks, [&](size_t i) {
+    const u8* compressed = compressed_data.data() + compressed_offsets[i];
+    u8* decompressed = raw_buffer.data() + i * chunk_size;
+    const size_t decompressed_size =
+        static_cast<size_t>(std::min<u64>(chunk_size, size - i * chunk_size));
+
+    if (compression_type == CompressionType::ChunkedZstd)
+    {
+      const size_t result =
+          ZSTD_decompress(decompressed, decompressed_size, compressed, compressed_sizes[i]);
+      if (ZSTD_isError(result) || result != decompressed_size)
+        success = false;
+    }
+    else
+    {
+      const int result = LZ4_decompress_safe(
+          reinterpret_cast<const char*>(compressed), reinterpret_cast<char*>(decompressed),
+          static_cast<int>(compressed_sizes[i]), static_cast<int>(decompressed_size));
+      if (result < 0 || static_cast<size_t>(result) != decompressed_size)
+        success = false;
+    }
+  });
+
+  if (!success)
+  {
+    PanicAlertFmt("Savestate decompression failed");
+    return false;
+  }
+
+  return true;
+}
+
 static bool ValidateHeaders(const StateHeader& header)
 {
   bool success = true;
@@ -819,6 +993,20 @@ static void LoadFileStateData(const std::string& filename, std::vector<u8>& ret_
 
     break;
   }
+  case CompressionType::ChunkedLZ4:
+  case CompressionType::ChunkedZstd:
+  {
+    const auto compression_type =
+        static_cast<CompressionType>(extended_header.base_header.compression_type);
+    Core::DisplayMessage("Decompressing State...", 500);
+    if (!DecompressChunks(buffer, extended_header.base_header.uncompressed_size, compression_type,
+                          f))
+    {
+      return;
+    }
+
+    break;
+  }
   case CompressionType::Uncompressed:
   {
     u64 header_len = sizeof(StateHeaderLegacy) + sizeof(StateHeaderVersion) +
@@ -913,6 +1101,8 @@ void LoadAs(Core::System& system, const std::string& filename)
             std::filesystem::path tempfilename(filename);
             Core::DisplayMessage(
                 fmt::format("Loaded State from {}", tempfilename.filename().string()), 2000);
+            // The rewind buffer belongs to the timeline that was just left
+            ClearRewindBuffer();
             if (File::Exists(filename + ".dtm"))
               movie.LoadInput(filename + ".dtm");
             else if (!movie.IsJustStartingRecordingInputFromSaveState() &&
@@ -934,6 +1124,184 @@ void LoadAs(Core::System& system, const std::string& filename)
       true);
 }
 
+static void StoreRewindState(std::vector<u8> state)
+{
+  // The worker is the only thread that replaces the latest state outside of Rewind(), which waits
+  // for the worker to become idle first, so reading it here without the lock is fine.
+  std::optional<RewindEntry> entry;
+  if (!s_rewind_latest_state.empty())
+  {
+    const std::vector<u8> delta = Common::CreateBinaryDelta(state, s_rewind_latest_state);
+    const int delta_size = static_cast<int>(delta.size());
+    if (delta.size() <= static_cast<size_t>(LZ4_MAX_INPUT_SIZE))
+    {
+      std::vector<u8> compressed(LZ4_compressBound(delta_size));
+      const int compressed_size =
+          LZ4_compress_default(reinterpret_cast<const char*>(delta.data()),
+                               reinterpret_cast<char*>(compressed.data()), delta_size,
+                               static_cast<int>(compressed.size()));
+      if (compressed_size > 0)
+      {
+        compressed.resize(compressed_size);
+        compressed.shrink_to_fit();
+        entry = RewindEntry{std::move(compressed), delta_size};
+      }
+    }
+  }
+
+  const size_t memory_limit = size_t(Config::Get(Config::MAIN_REWIND_MEMORY_LIMIT_MB)) << 20;
+
+  std::lock_guard lk(s_rewind_mutex);
+
+  // Without a delta the chain is broken, so older states can't be reached anymore
+  if (!entry)
+    s_rewind_entries.clear();
+  else
+    s_rewind_entries.push_back(std::move(*entry));
+
+  s_rewind_latest_state = std::move(state);
+
+  s_rewind_memory_usage = s_rewind_latest_state.size();
+  for (const RewindEntry& rewind_entry : s_rewind_entries)
+    s_rewind_memory_usage += rewind_entry.compressed_delta.size();
+
+  while (s_rewind_memory_usage > memory_limit && !s_rewind_entries.empty())
+  {
+    s_rewind_memory_usage -= s_rewind_entries.front().compressed_delta.size();
+    s_rewind_entries.pop_front();
+  }
+
+  s_rewind_stats.num_states = s_rewind_entries.size() + 1;
+  s_rewind_stats.memory_usage = s_rewind_memory_usage;
+}
+
+static bool IsRewindAllowed(Core::System& system)
+{
+  return !NetPlay::IsNetPlayRunning() && !system.GetMovie().IsMovieActive() &&
+         !AchievementManager::GetInstance().IsHardcoreModeActive();
+}
+
+static void CaptureRewindState(Core::System& system)
+{
+  if (!IsRewindAllowed(system))
+  {
+    s_rewind_capture_pending.store(false);
+    return;
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  std::vector<u8> buffer;
+  SaveToBuffer(system, buffer);
+  const auto stall = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - start);
+
+  {
+    std::lock_guard lk(s_rewind_mutex);
+    s_rewind_stats.last_capture_stall = stall;
+    s_rewind_stats.max_capture_stall = std::max(s_rewind_stats.max_capture_stall, stall);
+  }
+
+  s_rewind_thread.Push(std::move(buffer));
+}
+
+void OnFrameEnd(Core::System& system)
+{
+  const u32 interval = Config::Get(Config::MAIN_REWIND_FRAME_INTERVAL);
+  if (interval == 0 || ++s_rewind_frame_counter < interval)
+    return;
+
+  if (s_rewind_capture_pending.load() || !IsRewindAllowed(system))
+    return;
+
+  s_rewind_frame_counter = 0;
+  s_rewind_capture_pending.store(true);
+
+  // This is called from the VI event in the middle of CoreTiming::Advance, where the VI event
+  // hasn't been rescheduled yet and the timers are only partially updated. Such a state can't be
+  // loaded again, so the capture is done as a CPU thread job between two slices instead, the same
+  // way as a regular savestate.
+  Core::QueueHostJob([](Core::System& host_system) {
+    Core::RunOnCPUThread(host_system, [&host_system] { CaptureRewindState(host_system); }, false);
+  });
+}
+
+bool Rewind(Core::System& system)
+{
+  if (!IsRewindAllowed(system))
+  {
+    OSD::AddMessage("Rewinding is disabled in Netplay, during movies and in hardcore mode");
+    return false;
+  }
+
+  bool success = false;
+  Core::RunOnCPUThread(
+      system,
+      [&] {
+        s_rewind_thread.WaitForCompletion();
+
+        std::lock_guard lk(s_rewind_mutex);
+        if (s_rewind_entries.empty())
+          return;
+
+        const RewindEntry entry = std::move(s_rewind_entries.back());
+        s_rewind_entries.pop_back();
+        s_rewind_memory_usage -= entry.compressed_delta.size();
+
+        std::vector<u8> delta(entry.delta_size);
+        const int decompressed_size = LZ4_decompress_safe(
+            reinterpret_cast<const char*>(entry.compressed_delta.data()),
+            reinterpret_cast<char*>(delta.data()), static_cast<int>(entry.compressed_delta.size()),
+            entry.delta_size);
+        std::optional<std::vector<u8>> previous_state;
+        if (decompressed_size == entry.delta_size)
+          previous_state = Common::ApplyBinaryDelta(s_rewind_latest_state, delta);
+
+        if (!previous_state)
+        {
+          ERROR_LOG_FMT(CORE, "Failed to restore rewind state, clearing rewind buffer");
+          s_rewind_entries.clear();
+          s_rewind_latest_state.clear();
+          s_rewind_memory_usage = 0;
+          s_rewind_stats.num_states = 0;
+          s_rewind_stats.memory_usage = 0;
+          return;
+        }
+
+        s_rewind_memory_usage += previous_state->size();
+        s_rewind_memory_usage -= s_rewind_latest_state.size();
+        s_rewind_latest_state = std::move(*previous_state);
+        s_rewind_stats.num_states = s_rewind_entries.size() + 1;
+        s_rewind_stats.memory_usage = s_rewind_memory_usage;
+        s_rewind_frame_counter = 0;
+
+        LoadFromBuffer(system, s_rewind_latest_state);
+        success = true;
+      },
+      true);
+
+  if (!success)
+    OSD::AddMessage("There is no earlier state to rewind to");
+
+  return success;
+}
+
+void ClearRewindBuffer()
+{
+  s_rewind_thread.WaitForCompletion();
+
+  std::lock_guard lk(s_rewind_mutex);
+  s_rewind_entries.clear();
+  std::vector<u8>().swap(s_rewind_latest_state);
+  s_rewind_memory_usage = 0;
+  s_rewind_stats = {};
+}
+
+RewindStats GetRewindStats()
+{
+  std::lock_guard lk(s_rewind_mutex);
+  return s_rewind_stats;
+}
+
 void SetOnAfterLoadCallback(AfterLoadCallbackFunc callback)
 {
   s_on_after_load_callback = std::move(callback);
@@ -953,12 +1321,23 @@ void Init(Core::System& system)
     if (args.state_write_done_event)
       args.state_write_done_event->Set();
   });
+
+  // A capture that was queued right before the previous shutdown may never have run
+  s_rewind_capture_pending.store(false);
+  s_rewind_thread.Reset("Rewind Worker", [](std::vector<u8> state) {
+    StoreRewindState(std::move(state));
+    s_rewind_capture_pending.store(false);
+  });
 }
 
 void Shutdown()
 {
   s_save_thread.Shutdown();
 
+  ClearRewindBuffer();
+  s_rewind_thread.Shutdown();
+  s_rewind_frame_counter = 0;
+
   // swapping with an empty vector, rather than clear()ing
   // this gives a better guarantee to free the allocated memory right NOW (as opposed to, actually,
   // never)
@@ -1032,6 +1411,7 @@ void UndoLoadState(Core::System& system)
       if (File::Exists(dtmpath))
       {
         LoadFromBuffer(system, s_undo_load_buffer);
+        ClearRewindBuffer();
         movie.LoadInput(dtmpath);
       }
       else
@@ -1042,6 +1422,7 @@ void UndoLoadState(Core::System& system)
     else
     {
       LoadFromBuffer(system, s_undo_load_buffer);
+      ClearRewindBuffer();
     }
   }
   else
@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstddef>
 #include <functional>
 #include <string>
@@ -55,6 +56,10 @@ enum CompressionType : u16
 {
   Uncompressed = 0,
   LZ4 = 1,
+  // Independently compressed chunks, preceded by a table of their compressed sizes so that they
+  // can be compressed and decompressed in parallel.
+  ChunkedLZ4 = 2,
+  ChunkedZstd = 3,
   // Add new compression types after this, as the compression type
   // is numerically stored in the state file.
 };
@@ -109,6 +114,26 @@ void LoadAs(Core::System& system, const std::string& filename);
 void SaveToBuffer(Core::System& system, std::vector<u8>& buffer);
 void LoadFromBuffer(Core::System& system, std::vector<u8>& buffer);
 
+// Rewind keeps recent states in memory, captured every Main.Core.RewindFrameInterval frames on the
+// CPU thread and delta-compressed on a worker thread. Older states are dropped once the memory
+// limit is reached.
+struct RewindStats
+{
+  size_t num_states = 0;
+  size_t memory_usage = 0;
+  // How long the CPU thread was blocked serializing the latest capture, and the worst case so far.
+  std::chrono::microseconds last_capture_stall{};
+  std::chrono::microseconds max_capture_stall{};
+};
+
+// Called by the CPU thread at the end of every frame.
+void OnFrameEnd(Core::System& system);
+
+// Steps back to the previous captured state. Returns false if there is nothing to rewind to.
+bool Rewind(Core::System& system);
+void ClearRewindBuffer();
+RewindStats GetRewindStats();
+
 void LoadLastSaved(Core::System& system, int i = 1);
 void SaveFirstSaved(Core::System& system);
 void UndoSaveState(Core::System& system);
@@ -9,6 +9,7 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/IOFile.h"
+#include "Common/MappedFile.h"
 #include "DiscIO/Blob.h"
 
 namespace DiscIO
@@ -36,6 +37,9 @@ private:
   PlainFileReader(File::IOFile file);
 
   File::IOFile m_file;
+  // Only mapped if MAIN_MAP_DISC_IMAGES is enabled. If it is, reads are served from the mapping
+  // instead of m_file.
+  File::MappedFile m_mapping;
   u64 m_size;
 };
 
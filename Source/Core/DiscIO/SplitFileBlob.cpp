@@ -3,6 +3,7 @@
 
 #include "DiscIO/SplitFileBlob.h"
 
+#include <cstring>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -11,9 +12,11 @@
 #include <fmt/format.h>
 
 #include "Common/Assert.h"
+#include "Common/Config/Config.h"
 #include "Common/FileUtil.h"
 #include "Common/IOFile.h"
 #include "Common/MsgHandler.h"
+#include "Core/Config/MainSettings.h"
 
 namespace DiscIO
 {
@@ -45,6 +48,8 @@ std::unique_ptr<SplitPlainFileReader> SplitPlainFileReader::Create(std::string_v
     if (size == 0)
       return nullptr;
     files.emplace_back(SingleFile{std::move(f), offset, size});
+    if (Config::Get(Config::MAIN_MAP_DISC_IMAGES))
+      files.back().mapping.Map(files.back().file);
     offset += size;
     ++index;
   }
@@ -63,6 +68,8 @@ std::unique_ptr<BlobReader> SplitPlainFileReader::CopyReader() const
   {
     new_files.push_back(
         {.file = file.file.Duplicate("rb"), .offset = file.offset, .size = file.size});
+    if (file.mapping.IsMapped())
+      new_files.back().mapping.Map(new_files.back().file);
   }
   return std::unique_ptr<SplitPlainFileReader>(new SplitPlainFileReader(std::move(new_files)));
 }
@@ -82,7 +89,11 @@ bool SplitPlainFileReader::Read(u64 offset, u64 nbytes, u8* out_ptr)
       auto& f = file.file;
       const u64 seek_offset = current_offset - file.offset;
       const u64 current_read = std::min(file.size - seek_offset, rest);
-      if (!f.Seek(seek_offset, File::SeekOrigin::Begin) || !f.ReadBytes(out, current_read))
+      if (file.mapping.IsMapped())
+      {
+        std::memcpy(out, file.mapping.GetSpan().data() + seek_offset, current_read);
+      }
+      else if (!f.Seek(seek_offset, File::SeekOrigin::Begin) || !f.ReadBytes(out, current_read))
       {
         f.ClearError();
         return false;
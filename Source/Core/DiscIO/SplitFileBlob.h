@@ -11,6 +11,7 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/IOFile.h"
+#include "Common/MappedFile.h"
 #include "DiscIO/Blob.h"
 
 namespace DiscIO
@@ -40,6 +41,9 @@ private:
     File::IOFile file;
     u64 offset;
     u64 size;
+    // Only mapped if MAIN_MAP_DISC_IMAGES is enabled. If it is, reads are served from the mapping
+    // instead of file.
+    File::MappedFile mapping;
   };
 
   SplitPlainFileReader(std::vector<SingleFile> m_files);
@@ -10,6 +10,7 @@
 #include <optional>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <unordered_set>
 
 #include <mbedtls/md5.h>
@@ -413,6 +414,7 @@ void VolumeVerifier::Start()
   CheckMisc();
 
   SetUpHashing();
+  StartBlockVerificationThreads();
 }
 
 std::vector<Partition> VolumeVerifier::CheckPartitions()
@@ -1069,20 +1071,111 @@ void VolumeVerifier::SetUpHashing()
   {
     m_sha1_context = Common::SHA1::CreateContext();
   }
+
+  const auto run_task = [](AsyncTask task) { task(); };
+  if (m_hashes_to_calculate.crc32)
+    m_crc32_thread.Reset("VolumeVerifier CRC32", run_task);
+  if (m_hashes_to_calculate.md5)
+    m_md5_thread.Reset("VolumeVerifier MD5", run_task);
+  if (m_hashes_to_calculate.sha1)
+    m_sha1_thread.Reset("VolumeVerifier SHA1", run_task);
+  m_content_thread.Reset("VolumeVerifier Content", run_task);
+}
+
+void VolumeVerifier::StartBlockVerificationThreads()
+{
+  if (m_groups.empty())
+    return;
+
+  const size_t num_threads = std::clamp<size_t>(std::thread::hardware_concurrency(), 1,
+                                                VolumeWii::BLOCKS_PER_GROUP);
+  for (size_t i = 0; i < num_threads; ++i)
+  {
+    m_block_threads.emplace_back(std::make_unique<Common::WorkQueueThread<AsyncTask>>(
+        "VolumeVerifier Blocks", [](AsyncTask task) { task(); }));
+  }
+}
+
+void VolumeVerifier::QueueGroupVerification(bool read_failed)
+{
+  ASSERT(!m_verifying_group_index);
+
+  const GroupToVerify& group = m_groups[m_group_index];
+  const size_t blocks = group.block_index_end - group.block_index_start;
+  m_verifying_group_index = m_group_index;
+  m_verified_blocks.fill(false);
+  if (read_failed || blocks == 0)
+    return;
+
+  // VolumeWii loads the partition key and H3 table lazily, which isn't thread-safe, so the first
+  // block is checked before the other ones are handed to the worker threads.
+  m_verified_blocks[0] =
+      m_volume.CheckBlockIntegrity(group.block_index_start, m_data.data(), group.partition);
+
+  const size_t num_threads = m_block_threads.size();
+  const size_t blocks_per_thread = (blocks - 1 + num_threads - 1) / num_threads;
+  for (size_t i = 0; i < num_threads; ++i)
+  {
+    const size_t start = 1 + i * blocks_per_thread;
+    const size_t end = std::min(start + blocks_per_thread, blocks);
+    if (start >= end)
+      break;
+
+    m_block_threads[i]->Push([this, &group, start, end] {
+      for (size_t j = start; j < end; ++j)
+      {
+        m_verified_blocks[j] =
+            m_volume.CheckBlockIntegrity(group.block_index_start + j,
+                                         m_data.data() + j * VolumeWii::BLOCK_TOTAL_SIZE,
+                                         group.partition);
+      }
+    });
+  }
+}
+
+void VolumeVerifier::RecordGroupVerificationResult()
+{
+  if (!m_verifying_group_index)
+    return;
+
+  const GroupToVerify& group = m_groups[*m_verifying_group_index];
+  m_verifying_group_index.reset();
+
+  for (size_t i = 0; i < group.block_index_end - group.block_index_start; ++i)
+  {
+    const u64 block_offset = group.offset + i * VolumeWii::BLOCK_TOTAL_SIZE;
+
+    if (m_verified_blocks[i])
+    {
+      m_biggest_verified_offset =
+          std::max(m_biggest_verified_offset, block_offset + VolumeWii::BLOCK_TOTAL_SIZE);
+    }
+    else
+    {
+      if (m_scrubber.CanBlockBeScrubbed(block_offset))
+      {
+        WARN_LOG_FMT(DISCIO, "Integrity check failed for unused block at {:#x}", block_offset);
+        m_unused_block_errors[group.partition]++;
+      }
+      else
+      {
+        WARN_LOG_FMT(DISCIO, "Integrity check failed for block at {:#x}", block_offset);
+        m_block_errors[group.partition]++;
+      }
+    }
+  }
 }
 
-void VolumeVerifier::WaitForAsyncOperations() const
+void VolumeVerifier::WaitForAsyncOperations()
 {
-  if (m_crc32_future.valid())
-    m_crc32_future.wait();
-  if (m_md5_future.valid())
-    m_md5_future.wait();
-  if (m_sha1_future.valid())
-    m_sha1_future.wait();
-  if (m_content_future.valid())
-    m_content_future.wait();
-  if (m_group_future.valid())
-    m_group_future.wait();
+  m_crc32_thread.WaitForCompletion();
+  m_md5_thread.WaitForCompletion();
+  m_sha1_thread.WaitForCompletion();
+  m_content_thread.WaitForCompletion();
+  for (auto& thread : m_block_threads)
+    thread->WaitForCompletion();
+
+  RecordGroupVerificationResult();
 }
 
 bool VolumeVerifier::ReadChunkAndWaitForAsyncOperations(u64 bytes_to_read)
@@ -1099,6 +1192,9 @@ bool VolumeVerifier::ReadChunkAndWaitForAsyncOperations(u64 bytes_to_read)
     if (!m_volume.Read(m_progress + bytes_to_copy, bytes_to_read, data.data() + bytes_to_copy,
                        PARTITION_NONE))
     {
+      // The caller still queues work for the failed chunk, so the previous chunk must be done
+      // (and the results of its group recorded) before m_verified_blocks is reused
+      WaitForAsyncOperations();
       return false;
     }
   }
@@ -1196,7 +1292,7 @@ void VolumeVerifier::Process()
   {
     if (m_hashes_to_calculate.crc32)
     {
-      m_crc32_future = std::async(std::launch::async, [this, byte_increment] {
+      m_crc32_thread.Push([this, byte_increment] {
         m_crc32_context = Common::UpdateCRC32(m_crc32_context, m_data.data(),
                                               static_cast<size_t>(byte_increment));
       });
@@ -1204,14 +1300,14 @@ void VolumeVerifier::Process()
 
     if (m_hashes_to_calculate.md5)
     {
-      m_md5_future = std::async(std::launch::async, [this, byte_increment] {
+      m_md5_thread.Push([this, byte_increment] {
         mbedtls_md5_update_ret(&m_md5_context, m_data.data(), byte_increment);
       });
     }
 
     if (m_hashes_to_calculate.sha1)
     {
-      m_sha1_future = std::async(std::launch::async, [this, byte_increment] {
+      m_sha1_thread.Push([this, byte_increment] {
         m_sha1_context->Update(m_data.data(), byte_increment);
       });
     }
@@ -1219,7 +1315,7 @@ void VolumeVerifier::Process()
 
   if (content_read)
   {
-    m_content_future = std::async(std::launch::async, [this, read_failed, content] {
+    m_content_thread.Push([this, read_failed, content] {
       if (read_failed || !m_volume.CheckContentIntegrity(content, m_data, m_ticket))
       {
         AddProblem(Severity::High, Common::FmtFormatT("Content {0:08x} is corrupt.", content.id));
@@ -1231,37 +1327,7 @@ void VolumeVerifier::Process()
 
   if (group_read)
   {
-    m_group_future = std::async(std::launch::async, [this, read_failed,
-                                                     group_index = m_group_index] {
-      const GroupToVerify& group = m_groups[group_index];
-      u64 offset_in_group = 0;
-      for (u64 block_index = group.block_index_start; block_index < group.block_index_end;
-           ++block_index, offset_in_group += VolumeWii::BLOCK_TOTAL_SIZE)
-      {
-        const u64 block_offset = group.offset + offset_in_group;
-
-        if (!read_failed && m_volume.CheckBlockIntegrity(
-                                block_index, m_data.data() + offset_in_group, group.partition))
-        {
-          m_biggest_verified_offset =
-              std::max(m_biggest_verified_offset, block_offset + VolumeWii::BLOCK_TOTAL_SIZE);
-        }
-        else
-        {
-          if (m_scrubber.CanBlockBeScrubbed(block_offset))
-          {
-            WARN_LOG_FMT(DISCIO, "Integrity check failed for unused block at {:#x}", block_offset);
-            m_unused_block_errors[group.partition]++;
-          }
-          else
-          {
-            WARN_LOG_FMT(DISCIO, "Integrity check failed for block at {:#x}", block_offset);
-            m_block_errors[group.partition]++;
-          }
-        }
-      }
-    });
-
+    QueueGroupVerification(read_failed);
     m_group_index++;
   }
 
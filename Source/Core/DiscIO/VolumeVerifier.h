@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <array>
+#include <functional>
 #include <future>
 #include <map>
 #include <memory>
@@ -14,9 +16,11 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/Crypto/SHA1.h"
+#include "Common/WorkQueueThread.h"
 #include "Core/IOS/ES/Formats.h"
 #include "DiscIO/DiscScrubber.h"
 #include "DiscIO/Volume.h"
+#include "DiscIO/VolumeWii.h"
 
 // To be used as follows:
 //
@@ -156,7 +160,10 @@ private:
   void CheckMisc();
   void CheckSuperPaperMario();
   void SetUpHashing();
-  void WaitForAsyncOperations() const;
+  void StartBlockVerificationThreads();
+  void QueueGroupVerification(bool read_failed);
+  void RecordGroupVerificationResult();
+  void WaitForAsyncOperations();
   bool ReadChunkAndWaitForAsyncOperations(u64 bytes_to_read);
 
   void AddProblem(Severity severity, std::string text);
@@ -180,11 +187,18 @@ private:
 
   u64 m_excess_bytes = 0;
   std::vector<u8> m_data;
-  std::future<void> m_crc32_future;
-  std::future<void> m_md5_future;
-  std::future<void> m_sha1_future;
-  std::future<void> m_content_future;
-  std::future<void> m_group_future;
+
+  // The worker threads process m_data while the next chunk is being read. Each hash is updated on
+  // its own thread, since the chunks must be hashed in order, while the blocks of a Wii group are
+  // spread across all of the block verification threads.
+  using AsyncTask = std::function<void()>;
+  Common::WorkQueueThread<AsyncTask> m_crc32_thread;
+  Common::WorkQueueThread<AsyncTask> m_md5_thread;
+  Common::WorkQueueThread<AsyncTask> m_sha1_thread;
+  Common::WorkQueueThread<AsyncTask> m_content_thread;
+  std::vector<std::unique_ptr<Common::WorkQueueThread<AsyncTask>>> m_block_threads;
+  std::optional<size_t> m_verifying_group_index;
+  std::array<bool, VolumeWii::BLOCKS_PER_GROUP> m_verified_blocks{};
 
   DiscScrubber m_scrubber;
   IOS::ES::TicketReader m_ticket;
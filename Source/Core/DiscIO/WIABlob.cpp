@@ -542,7 +542,7 @@ bool WIARVZFileReader<RVZ>::ReadFromGroups(u64* offset, u64* size, u8** out_ptr,
 
       if (!chunk.Read(offset_in_group, bytes_to_read, *out_ptr))
       {
-        m_cached_chunk_offset = std::numeric_limits<u64>::max();  // Invalidate the cache
+        InvalidateCachedChunk(group_offset_in_file);
         return false;
       }
 
@@ -572,8 +572,18 @@ WIARVZFileReader<RVZ>::ReadCompressedData(u64 offset_in_file, u64 compressed_siz
                                           WIARVZCompressionType compression_type,
                                           u32 exception_lists, u32 rvz_packed_size, u64 data_offset)
 {
-  if (offset_in_file == m_cached_chunk_offset)
-    return m_cached_chunk;
+  CachedChunk* least_recently_used = &m_chunk_cache[0];
+  for (CachedChunk& cached_chunk : m_chunk_cache)
+  {
+    if (cached_chunk.offset_in_file == offset_in_file)
+    {
+      cached_chunk.last_used = ++m_chunk_cache_counter;
+      return cached_chunk.chunk;
+    }
+
+    if (cached_chunk.last_used < least_recently_used->last_used)
+      least_recently_used = &cached_chunk;
+  }
 
   std::unique_ptr<Decompressor> decompressor;
   switch (compression_type)
@@ -603,11 +613,53 @@ WIARVZFileReader<RVZ>::ReadCompressedData(u64 offset_in_file, u64 compressed_siz
 
   const bool compressed_exception_lists = compression_type > WIARVZCompressionType::Purge;
 
-  m_cached_chunk =
+  ReleaseCachedChunk(least_recently_used);
+  least_recently_used->chunk =
       Chunk(&m_file, offset_in_file, compressed_size, decompressed_size, exception_lists,
             compressed_exception_lists, rvz_packed_size, data_offset, std::move(decompressor));
-  m_cached_chunk_offset = offset_in_file;
-  return m_cached_chunk;
+  least_recently_used->offset_in_file = offset_in_file;
+  least_recently_used->last_used = ++m_chunk_cache_counter;
+  least_recently_used->size = compressed_size + decompressed_size;
+  m_chunk_cache_bytes += least_recently_used->size;
+
+  // Make room for the new chunk by dropping the least recently used ones
+  while (m_chunk_cache_bytes > CHUNK_CACHE_MAX_BYTES)
+  {
+    CachedChunk* oldest = nullptr;
+    for (CachedChunk& cached_chunk : m_chunk_cache)
+    {
+      if (&cached_chunk != least_recently_used && cached_chunk.size != 0 &&
+          (!oldest || cached_chunk.last_used < oldest->last_used))
+      {
+        oldest = &cached_chunk;
+      }
+    }
+    if (!oldest)
+      break;
+    ReleaseCachedChunk(oldest);
+  }
+
+  return least_recently_used->chunk;
+}
+
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::InvalidateCachedChunk(u64 offset_in_file)
+{
+  for (CachedChunk& cached_chunk : m_chunk_cache)
+  {
+    if (cached_chunk.offset_in_file == offset_in_file)
+      ReleaseCachedChunk(&cached_chunk);
+  }
+}
+
+template <bool RVZ>
+void WIARVZFileReader<RVZ>::ReleaseCachedChunk(CachedChunk* cached_chunk)
+{
+  m_chunk_cache_bytes -= cached_chunk->size;
+  cached_chunk->chunk = Chunk();
+  cached_chunk->offset_in_file = std::numeric_limits<u64>::max();
+  cached_chunk->last_used = 0;
+  cached_chunk->size = 0;
 }
 
 template <bool RVZ>
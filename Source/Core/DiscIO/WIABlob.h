@@ -240,6 +240,7 @@ private:
   Chunk& ReadCompressedData(u64 offset_in_file, u64 compressed_size, u64 decompressed_size,
                             WIARVZCompressionType compression_type, u32 exception_lists = 0,
                             u32 rvz_packed_size = 0, u64 data_offset = 0);
+  void InvalidateCachedChunk(u64 offset_in_file);
 
   static bool ApplyHashExceptions(const std::vector<HashExceptionEntry>& exception_list,
                                   VolumeWii::HashBlock hash_blocks[VolumeWii::BLOCKS_PER_GROUP]);
@@ -366,8 +367,27 @@ private:
 
   File::IOFile m_file;
   std::string m_path;
-  Chunk m_cached_chunk;
-  u64 m_cached_chunk_offset = std::numeric_limits<u64>::max();
+
+  struct CachedChunk
+  {
+    Chunk chunk;
+    u64 offset_in_file = std::numeric_limits<u64>::max();
+    u64 last_used = 0;
+    // Memory taken by the compressed and decompressed data of the chunk
+    u64 size = 0;
+  };
+
+  void ReleaseCachedChunk(CachedChunk* cached_chunk);
+
+  // Games often alternate between a few places on the disc, so keep the most recently used
+  // chunks around instead of decompressing the same group over and over again. The cache is
+  // bounded by the memory the chunks take, as WIA chunks can be much larger than RVZ chunks.
+  // The most recently used chunk is always kept, even if it's larger than the limit on its own.
+  static constexpr size_t CHUNK_CACHE_MAX_ENTRIES = 16;
+  static constexpr u64 CHUNK_CACHE_MAX_BYTES = 16 * 1024 * 1024;
+  std::array<CachedChunk, CHUNK_CACHE_MAX_ENTRIES> m_chunk_cache;
+  u64 m_chunk_cache_bytes = 0;
+  u64 m_chunk_cache_counter = 0;
   WiiEncryptionCache m_encryption_cache;
 
   std::vector<HashExceptionEntry> m_exception_list;
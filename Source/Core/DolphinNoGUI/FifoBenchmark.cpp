@@ -0,0 +1,179 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "DolphinNoGUI/FifoBenchmark.h"
+
+#include <utility>
+
+#include <picojson.h>
+
+#include "Common/JsonUtil.h"
+#include "Common/MemoryUtil.h"
+#include "Core/Config/GraphicsSettings.h"
+#include "Core/Config/MainSettings.h"
+#include "Core/FifoPlayer/FifoPlayer.h"
+#include "Core/Host.h"
+#include "Core/System.h"
+#include "VideoCommon/Statistics.h"
+#include "VideoCommon/VideoEvents.h"
+
+FifoBenchmark::FifoBenchmark(u32 loops) : m_loops(loops)
+{
+}
+
+void FifoBenchmark::BeginLog(const std::string& path)
+{
+  // Play back as fast as possible
+  Config::SetCurrent(Config::MAIN_EMULATION_SPEED, 0.0f);
+  Config::SetCurrent(Config::GFX_VSYNC, false);
+  // Every loop after the first is played by FifoPlayer looping the log. Early memory updates change
+  // the amount of work per frame, so they're pinned to the default rather than left to the user's
+  // FIFO player settings.
+  Config::SetCurrent(Config::MAIN_FIFOPLAYER_LOOP_REPLAY, true);
+  Config::SetCurrent(Config::MAIN_FIFOPLAYER_EARLY_MEMORY_UPDATES,
+                     Config::MAIN_FIFOPLAYER_EARLY_MEMORY_UPDATES.GetDefaultValue());
+
+  LogResult& result = m_results.emplace_back();
+  result.path = path;
+
+  m_frames_written = 0;
+  m_done = false;
+  m_pending = {};
+  m_last_pipeline_cache_misses = 0;
+
+  Core::System::GetInstance().GetFifoPlayer().SetFrameWrittenCallback(
+      [this] { OnFrameWritten(); });
+  m_after_frame_hook =
+      AfterFrameEvent::Register([this](Core::System&) { OnAfterFrame(); }, "FifoBenchmark");
+}
+
+void FifoBenchmark::EndLog(bool booted)
+{
+  Core::System::GetInstance().GetFifoPlayer().SetFrameWrittenCallback(nullptr);
+  m_after_frame_hook.reset();
+
+  LogResult& result = m_results.back();
+  result.booted = booted;
+  result.peak_memory = Common::MemPeakResident();
+}
+
+void FifoBenchmark::OnFrameWritten()
+{
+  if (m_done)
+    return;
+
+  LogResult& result = m_results.back();
+
+  // FifoPlayer waits for the GPU to go idle after writing a frame, so by the time the next frame
+  // is about to be written, everything that belongs to the previous one has been processed.
+  if (m_frames_written == 0)
+  {
+    const FifoPlayer& fifo_player = Core::System::GetInstance().GetFifoPlayer();
+    result.frames_per_loop = fifo_player.GetFrameRangeEnd() - fifo_player.GetFrameRangeStart() + 1;
+
+    // Drop whatever the GPU thread did while booting
+    std::lock_guard lk(m_pending_lock);
+    m_pending = {};
+  }
+  else
+  {
+    FrameSample sample;
+    {
+      std::lock_guard lk(m_pending_lock);
+      sample = std::exchange(m_pending, {});
+    }
+    sample.time_ms =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_frame_start)
+            .count();
+
+    const u64 frame = m_frames_written - 1;
+    if (frame % result.frames_per_loop == 0)
+      result.loops.emplace_back();
+    result.loops.back().push_back(sample);
+
+    if (frame + 1 == u64(m_loops) * result.frames_per_loop)
+    {
+      m_done = true;
+      Host_Message(HostMessageID::WMUserStop);
+      return;
+    }
+  }
+
+  ++m_frames_written;
+  m_frame_start = std::chrono::steady_clock::now();
+}
+
+void FifoBenchmark::OnAfterFrame()
+{
+  // A frame of the FIFO log can contain more than one XFB copy
+  std::lock_guard lk(m_pending_lock);
+
+  // The counter is reset when the shader cache is reloaded
+  const int pipeline_cache_misses = g_stats.num_pipeline_cache_misses;
+  if (pipeline_cache_misses < m_last_pipeline_cache_misses)
+    m_last_pipeline_cache_misses = 0;
+  m_pending.shader_compile_stalls += pipeline_cache_misses - m_last_pipeline_cache_misses;
+  m_last_pipeline_cache_misses = pipeline_cache_misses;
+
+  m_pending.draw_calls += g_stats.this_frame.num_draw_calls;
+  m_pending.texture_lookups += g_stats.this_frame.num_texture_lookups;
+  m_pending.texture_cache_misses += g_stats.this_frame.num_texture_cache_misses;
+}
+
+bool FifoBenchmark::WriteResults(const std::string& path) const
+{
+  const auto to_json = [](const FrameSample& sample) {
+    picojson::object object;
+    object.emplace("time_ms", picojson::value(sample.time_ms));
+    object.emplace("draw_calls", picojson::value(double(sample.draw_calls)));
+    object.emplace("shader_compile_stalls", picojson::value(double(sample.shader_compile_stalls)));
+    object.emplace("texture_lookups", picojson::value(double(sample.texture_lookups)));
+    object.emplace("texture_cache_misses", picojson::value(double(sample.texture_cache_misses)));
+    if (sample.texture_lookups != 0)
+    {
+      const int hits = sample.texture_lookups - sample.texture_cache_misses;
+      object.emplace("texture_cache_hit_rate",
+                     picojson::value(double(hits) / sample.texture_lookups));
+    }
+    return object;
+  };
+
+  picojson::array logs;
+  for (const LogResult& result : m_results)
+  {
+    picojson::array loops;
+    for (const std::vector<FrameSample>& frames : result.loops)
+    {
+      FrameSample total;
+      picojson::array frame_array;
+      for (const FrameSample& frame : frames)
+      {
+        frame_array.emplace_back(to_json(frame));
+        total.time_ms += frame.time_ms;
+        total.draw_calls += frame.draw_calls;
+        total.shader_compile_stalls += frame.shader_compile_stalls;
+        total.texture_lookups += frame.texture_lookups;
+        total.texture_cache_misses += frame.texture_cache_misses;
+      }
+
+      picojson::object loop = to_json(total);
+      loop.emplace("frames", picojson::value(std::move(frame_array)));
+      loops.emplace_back(std::move(loop));
+    }
+
+    picojson::object log;
+    log.emplace("path", picojson::value(result.path));
+    log.emplace("booted", picojson::value(result.booted));
+    log.emplace("frames_per_loop", picojson::value(double(result.frames_per_loop)));
+    // This is the high-water mark of the whole process up to the end of this log
+    log.emplace("peak_memory_bytes", picojson::value(double(result.peak_memory)));
+    log.emplace("loops", picojson::value(std::move(loops)));
+    logs.emplace_back(std::move(log));
+  }
+
+  picojson::object root;
+  root.emplace("video_backend", picojson::value(Config::Get(Config::MAIN_GFX_BACKEND)));
+  root.emplace("loops", picojson::value(double(m_loops)));
+  root.emplace("logs", picojson::value(std::move(logs)));
+  return JsonToFile(path, picojson::value(std::move(root)), true);
+}
@@ -0,0 +1,70 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "Common/CommonTypes.h"
+#include "Common/HookableEvent.h"
+
+// Plays FIFO logs a fixed number of times without any throttling and records statistics for every
+// frame, so that changes to the video code can be checked for performance regressions.
+class FifoBenchmark
+{
+public:
+  explicit FifoBenchmark(u32 loops);
+
+  // Must be called before booting the log, and after the emulation has been shut down again.
+  void BeginLog(const std::string& path);
+  void EndLog(bool booted);
+  // Whether all loops of the current log have been played.
+  bool IsLogComplete() const { return m_done; }
+
+  bool WriteResults(const std::string& path) const;
+
+private:
+  struct FrameSample
+  {
+    // From handing the frame to the GPU until the GPU went idle after processing it
+    double time_ms = 0;
+    int draw_calls = 0;
+    // Pipelines that weren't compiled yet when they were first needed
+    int shader_compile_stalls = 0;
+    int texture_lookups = 0;
+    int texture_cache_misses = 0;
+  };
+
+  struct LogResult
+  {
+    std::string path;
+    bool booted = false;
+    u32 frames_per_loop = 0;
+    u64 peak_memory = 0;
+    std::vector<std::vector<FrameSample>> loops;
+  };
+
+  // Called on the CPU thread before every frame is written to the FIFO
+  void OnFrameWritten();
+  // Called on the GPU thread when a frame is finished
+  void OnAfterFrame();
+
+  u32 m_loops;
+  std::vector<LogResult> m_results;
+
+  u64 m_frames_written = 0;
+  bool m_done = false;
+  std::chrono::steady_clock::time_point m_frame_start;
+
+  // Statistics of the frame that is currently being processed by the GPU thread
+  std::mutex m_pending_lock;
+  FrameSample m_pending;
+  // Value of g_stats.num_pipeline_cache_misses at the end of the previous frame, only accessed by
+  // the GPU thread after the log has booted
+  int m_last_pipeline_cache_misses = 0;
+
+  Common::EventHook m_after_frame_hook;
+};
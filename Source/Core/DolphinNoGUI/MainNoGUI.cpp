@@ -7,8 +7,11 @@
 #include <cstddef>
 #include <cstdio>
 #include <cstring>
+#include <memory>
+#include <optional>
 #include <signal.h>
 #include <string>
+#include <variant>
 #include <vector>
 
 #ifndef _WIN32
@@ -23,9 +26,12 @@
 #include "Core/BootManager.h"
 #include "Core/Core.h"
 #include "Core/DolphinAnalytics.h"
+#include "Core/FifoPlayer/FifoDataFile.h"
 #include "Core/Host.h"
 #include "Core/System.h"
 
+#include "DolphinNoGUI/FifoBenchmark.h"
+
 #include "UICommon/CommandLineParse.h"
 #ifdef USE_DISCORD_PRESENCE
 #include "UICommon/DiscordPresence.h"
@@ -197,6 +203,35 @@ static std::unique_ptr<Platform> GetPlatform(const optparse::Values& options)
   return nullptr;
 }
 
+// Boots the FIFO logs one after another, stopping each one once it has been played as often as
+// requested. Returns false if the benchmark was interrupted.
+static bool RunFifoBenchmark(FifoBenchmark& benchmark, const std::vector<std::string>& logs,
+                             const WindowSystemInfo& wsi)
+{
+  auto& system = Core::System::GetInstance();
+  for (const std::string& log : logs)
+  {
+    benchmark.BeginLog(log);
+
+    const bool booted = BootManager::BootCore(system, BootParameters::GenerateFromFile(log), wsi);
+    if (booted)
+      s_platform->MainLoop();
+    else
+      fprintf(stderr, "Could not boot %s\n", log.c_str());
+
+    Core::Stop(system);
+    Core::Shutdown(system);
+    benchmark.EndLog(booted);
+
+    if (booted && !benchmark.IsLogComplete())
+      return false;
+
+    s_platform->ResetRunningFlag();
+  }
+
+  return true;
+}
+
 #ifdef _WIN32
 #define main app_main
 #endif
@@ -228,6 +263,17 @@ int main(int argc, char* argv[])
             "macos"
 #endif
       });
+  parser->add_option("--benchmark_output")
+      .action("store")
+      .metavar("<file>")
+      .type("string")
+      .help("Play the given FIFO logs without throttling and write per-frame statistics to a "
+            "JSON file");
+  parser->add_option("--benchmark_loops")
+      .action("store")
+      .type("int")
+      .set_default(1)
+      .help("How many times each FIFO log is played when benchmarking");
 
   optparse::Values& options = CommandLineParse::ParseArguments(parser.get(), argc, argv);
   std::vector<std::string> args = parser->args();
@@ -240,7 +286,55 @@ int main(int argc, char* argv[])
 
   std::unique_ptr<BootParameters> boot;
   bool game_specified = false;
-  if (options.is_set("exec"))
+  std::optional<FifoBenchmark> benchmark;
+  std::vector<std::string> benchmark_logs;
+  if (options.is_set("benchmark_output"))
+  {
+    if (options.is_set("exec"))
+    {
+      const std::list<std::string> paths_list = options.all("exec");
+      benchmark_logs.assign(paths_list.begin(), paths_list.end());
+    }
+    else
+    {
+      benchmark_logs = std::move(args);
+    }
+
+    const int loops = static_cast<int>(options.get("benchmark_loops"));
+    if (benchmark_logs.empty() || loops < 1)
+    {
+      fprintf(stderr, "Benchmarking needs at least one FIFO log and one loop\n");
+      parser->print_help();
+      return 1;
+    }
+
+    // The benchmark only advances when the FIFO player presents a frame, so anything else would
+    // never finish
+    for (const std::string& log : benchmark_logs)
+    {
+      const std::unique_ptr<BootParameters> log_boot = BootParameters::GenerateFromFile(log);
+      if (!log_boot || !std::holds_alternative<BootParameters::DFF>(log_boot->parameters))
+      {
+        fprintf(stderr, "%s is not a FIFO log\n", log.c_str());
+        return 1;
+      }
+
+      const std::optional<u32> frame_count = FifoDataFile::ReadFrameCount(log);
+      if (!frame_count)
+      {
+        fprintf(stderr, "Could not read the FIFO log %s\n", log.c_str());
+        return 1;
+      }
+      if (*frame_count == 0)
+      {
+        fprintf(stderr, "The FIFO log %s has no frames\n", log.c_str());
+        return 1;
+      }
+    }
+
+    benchmark.emplace(static_cast<u32>(loops));
+  }
+  else if (options.is_set("exec"))
   {
     const std::list<std::string> paths_list = options.all("exec");
     const std::vector<std::string> paths{std::make_move_iterator(std::begin(paths_list)),
@@ -322,6 +416,20 @@ int main(int argc, char* argv[])
 
   DolphinAnalytics::Instance().ReportDolphinStart("nogui");
 
+  if (benchmark)
+  {
+    const bool completed = RunFifoBenchmark(*benchmark, benchmark_logs, wsi);
+    s_platform.reset();
+
+    const std::string output_path = static_cast<const char*>(options.get("benchmark_output"));
+    if (!benchmark->WriteResults(output_path))
+    {
+      fprintf(stderr, "Could not write the benchmark results to %s\n", output_path.c_str());
+      return 1;
+    }
+    return completed ? 0 : 1;
+  }
+
   if (!BootManager::BootCore(Core::System::GetInstance(), std::move(boot), wsi))
   {
     fprintf(stderr, "Could not boot the specified file\n");
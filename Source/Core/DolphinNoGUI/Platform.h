@@ -30,6 +30,9 @@ public:
   // Request an immediate shutdown.
   void Stop();
 
+  // Lets MainLoop() run again after it has returned.
+  void ResetRunningFlag() { m_running.Set(); }
+
   static std::unique_ptr<Platform> CreateHeadlessPlatform();
 #ifdef HAVE_X11
   static std::unique_ptr<Platform> CreateX11Platform();
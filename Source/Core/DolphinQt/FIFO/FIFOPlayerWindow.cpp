@@ -305,15 +305,8 @@ void FIFOPlayerWindow::UpdateInfo()
   if (m_fifo_recorder.IsRecordingDone())
   {
     FifoDataFile* file = m_fifo_recorder.GetRecordedFile();
-    size_t fifo_bytes = 0;
-    size_t mem_bytes = 0;
-
-    for (u32 i = 0; i < file->GetFrameCount(); ++i)
-    {
-      fifo_bytes += file->GetFrame(i).fifoData.size();
-      for (const auto& mem_update : file->GetFrame(i).memoryUpdates)
-        mem_bytes += mem_update.data.size();
-    }
+    const u64 fifo_bytes = file->GetFifoDataSize();
+    const u64 mem_bytes = file->GetMemoryUpdateDataSize();
 
     m_info_label->setText(tr("%1 FIFO bytes\n%2 memory bytes\n%3 frames")
                               .arg(QString::number(fifo_bytes), QString::number(mem_bytes),
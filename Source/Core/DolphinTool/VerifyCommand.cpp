@@ -3,6 +3,7 @@
 
 #include "DolphinTool/VerifyCommand.h"
 
+#include <chrono>
 #include <cstdlib>
 #include <string>
 #include <vector>
@@ -30,7 +31,8 @@ static std::string HashToHexString(const std::vector<u8>& hash)
   return ss.str();
 }
 
-static void PrintFullReport(const DiscIO::VolumeVerifier::Result& result)
+static void PrintFullReport(const DiscIO::VolumeVerifier::Result& result, u64 bytes,
+                            std::chrono::duration<double> elapsed)
 {
   if (!result.hashes.crc32.empty())
     fmt::print(std::cout, "CRC32: {}\n", HashToHexString(result.hashes.crc32));
@@ -72,6 +74,10 @@ static void PrintFullReport(const DiscIO::VolumeVerifier::Result& result)
     }
     fmt::print(std::cout, "\nSummary: {}\n\n", problem.text);
   }
+
+  const double mib = static_cast<double>(bytes) / (1024 * 1024);
+  fmt::print(std::cout, "Verified {:.1f} MiB in {:.2f} s ({:.1f} MiB/s)\n", mib, elapsed.count(),
+             elapsed.count() > 0 ? mib / elapsed.count() : 0.0);
 }
 
 int VerifyCommand(const std::vector<std::string>& args)
@@ -156,6 +162,7 @@ int VerifyCommand(const std::vector<std::string>& args)
   }
 
   // Verify the volume
+  const auto start_time = std::chrono::steady_clock::now();
   DiscIO::VolumeVerifier verifier(*volume, false, hashes_to_calculate);
   verifier.Start();
   while (verifier.GetBytesProcessed() != verifier.GetTotalBytes())
@@ -163,6 +170,7 @@ int VerifyCommand(const std::vector<std::string>& args)
     verifier.Process();
   }
   verifier.Finish();
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_time;
   const DiscIO::VolumeVerifier::Result& result = verifier.GetResult();
 
 #ifdef USE_RETRO_ACHIEVEMENTS
@@ -176,7 +184,7 @@ int VerifyCommand(const std::vector<std::string>& args)
   // Print the report
   if (!algorithm_is_set)
   {
-    PrintFullReport(result);
+    PrintFullReport(result, verifier.GetTotalBytes(), elapsed);
   }
   else
   {
@@ -7,6 +7,7 @@
 #include <array>
 #include <cstdio>
 #include <cstring>
+#include <filesystem>
 #include <iterator>
 #include <map>
 #include <memory>
@@ -99,11 +100,26 @@ GameFile::LookupUsingConfigLanguage(const std::map<DiscIO::Language, std::string
   return Lookup(GetConfigLanguage(), strings);
 }
 
+static std::pair<u64, s64> GetFileSizeAndModificationTime(const std::string& path)
+{
+  std::error_code error;
+  const std::filesystem::path fs_path = StringToPath(path);
+  const std::uintmax_t size = std::filesystem::file_size(fs_path, error);
+  if (error)
+    return {0, 0};
+  const std::filesystem::file_time_type time = std::filesystem::last_write_time(fs_path, error);
+  if (error)
+    return {size, 0};
+  return {size, time.time_since_epoch().count()};
+}
+
 GameFile::GameFile() = default;
 
 GameFile::GameFile(std::string path) : m_file_path(std::move(path))
 {
   m_file_name = PathToFileName(m_file_path);
+  std::tie(m_file_size_on_disk, m_file_modification_time) =
+      GetFileSizeAndModificationTime(m_file_path);
 
   {
     std::unique_ptr<DiscIO::Volume> volume(DiscIO::CreateVolume(m_file_path));
@@ -187,6 +203,12 @@ GameFile::GameFile(std::string path) : m_file_path(std::move(path))
 
 GameFile::~GameFile() = default;
 
+bool GameFile::FileChangedOnDisk() const
+{
+  return GetFileSizeAndModificationTime(m_file_path) !=
+         std::make_pair(m_file_size_on_disk, m_file_modification_time);
+}
+
 bool GameFile::IsValid() const
 {
   if (!m_valid)
@@ -298,6 +320,8 @@ void GameFile::DoState(PointerWrap& p)
   p.Do(m_file_name);
 
   p.Do(m_file_size);
+  p.Do(m_file_size_on_disk);
+  p.Do(m_file_modification_time);
   p.Do(m_volume_size);
   p.Do(m_volume_size_type);
   p.Do(m_is_datel_disc);
@@ -4,12 +4,15 @@
 #include "UICommon/GameFileCache.h"
 
 #include <algorithm>
+#include <condition_variable>
 #include <cstddef>
+#include <deque>
 #include <functional>
 #include <list>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -19,6 +22,7 @@
 #include "Common/FileSearch.h"
 #include "Common/FileUtil.h"
 #include "Common/IOFile.h"
+#include "Common/MappedFile.h"
 
 #include "DiscIO/DirectoryBlob.h"
 
@@ -26,7 +30,68 @@
 
 namespace UICommon
 {
-static constexpr u32 CACHE_REVISION = 25;  // Last changed in PR 12702
+static constexpr u32 CACHE_REVISION = 26;  // Last changed for the file change detection
+
+// Scanning game files mostly waits for reads, possibly from network storage, so more threads than
+// there are CPU cores are used to keep several reads in flight.
+static constexpr u32 MAX_SCAN_THREADS = 16;
+
+// Runs work(i) for every i below count on a pool of threads, and passes each result to on_done on
+// the calling thread as soon as it's available. Results arrive in no particular order.
+template <typename T>
+static void RunInParallel(size_t count, const std::atomic_bool& processing_halted,
+                          const std::function<T(size_t)>& work,
+                          const std::function<void(size_t, T)>& on_done)
+{
+  const size_t num_threads = std::min<size_t>(
+      count, std::clamp(std::thread::hardware_concurrency() * 2, 2u, MAX_SCAN_THREADS));
+  if (num_threads == 0)
+    return;
+
+  std::mutex mutex;
+  std::condition_variable results_available;
+  std::deque<std::pair<size_t, T>> results;
+  size_t finished_threads = 0;
+  std::atomic_size_t next_index = 0;
+
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads);
+  for (size_t i = 0; i < num_threads; ++i)
+  {
+    threads.emplace_back([&] {
+      for (size_t index = next_index++; index < count && !processing_halted; index = next_index++)
+      {
+        T result = work(index);
+        std::lock_guard lock(mutex);
+        results.emplace_back(index, std::move(result));
+        results_available.notify_one();
+      }
+
+      std::lock_guard lock(mutex);
+      ++finished_threads;
+      results_available.notify_one();
+    });
+  }
+
+  std::unique_lock lock(mutex);
+  while (true)
+  {
+    results_available.wait(lock,
+                           [&] { return !results.empty() || finished_threads == num_threads; });
+    if (results.empty())
+      break;
+
+    auto [index, result] = std::move(results.front());
+    results.pop_front();
+    lock.unlock();
+    on_done(index, std::move(result));
+    lock.lock();
+  }
+  lock.unlock();
+
+  for (std::thread& thread : threads)
+    thread.join();
+}
 
 std::vector<std::string> FindAllGamePaths(const std::vector<std::string>& directories_to_scan,
                                           bool recursive_scan)
@@ -129,24 +194,47 @@ bool GameFileCache::Update(std::span<const std::string> all_game_paths,
     m_cached_files.erase(it, m_cached_files.end());
   }
 
-  // Now that the previous loop has run, game_paths only contains paths that
-  // aren't in m_cached_files, so we simply add all of them to m_cached_files.
-  for (const std::string& path : game_paths)
+  // Files whose size or modification time changed since they were cached are scanned again.
+  std::vector<u8> files_changed(m_cached_files.size());
+  RunInParallel<bool>(
+      m_cached_files.size(), processing_halted,
+      [this](size_t i) { return m_cached_files[i]->FileChangedOnDisk(); },
+      [&files_changed](size_t i, bool changed) { files_changed[i] = changed; });
+  if (processing_halted)
+    return cache_changed;
+
+  for (size_t i = m_cached_files.size(); i-- > 0;)
   {
-    if (processing_halted)
-      break;
+    if (!files_changed[i])
+      continue;
 
-    auto file = std::make_shared<GameFile>(path);
-    if (file->IsValid())
-    {
-      if (game_added_to_cache)
-        game_added_to_cache(file);
+    const std::string& path = m_cached_files[i]->GetFilePath();
+    if (game_removed_from_cache)
+      game_removed_from_cache(path);
+    game_paths.insert(path);
 
-      cache_changed = true;
-      m_cached_files.push_back(std::move(file));
-    }
+    cache_changed = true;
+    m_cached_files[i] = std::move(m_cached_files.back());
+    m_cached_files.pop_back();
   }
 
+  // Now that the previous loops have run, game_paths only contains paths that
+  // aren't in m_cached_files, so we simply add all of them to m_cached_files.
+  const std::vector<std::string> paths_to_scan(game_paths.begin(), game_paths.end());
+  RunInParallel<std::shared_ptr<GameFile>>(
+      paths_to_scan.size(), processing_halted,
+      [&paths_to_scan](size_t i) { return std::make_shared<GameFile>(paths_to_scan[i]); },
+      [&](size_t, std::shared_ptr<GameFile> file) {
+        if (!file->IsValid())
+          return;
+
+        if (game_added_to_cache)
+          game_added_to_cache(file);
+
+        cache_changed = true;
+        m_cached_files.push_back(std::move(file));
+      });
+
   return cache_changed;
 }
 
@@ -155,27 +243,45 @@ bool GameFileCache::UpdateAdditionalMetadata(const GameUpdatedFn& game_updated,
 {
   bool cache_changed = false;
 
-  for (std::shared_ptr<GameFile>& file : m_cached_files)
+  // Covers are downloaded one at a time on the calling thread, so that scanning doesn't send a
+  // burst of requests to GameTDB. Only the local work below is spread over the worker threads.
+  for (const std::shared_ptr<GameFile>& file : m_cached_files)
   {
     if (processing_halted)
-      break;
-
-    const bool updated = UpdateAdditionalMetadata(&file);
-    cache_changed |= updated;
-    if (game_updated && updated)
-      game_updated(file);
+      return cache_changed;
+    file->DownloadDefaultCover();
   }
 
+  // Only the calling thread replaces entries of m_cached_files, and each worker thread only reads
+  // the entry that it was given.
+  RunInParallel<std::shared_ptr<GameFile>>(
+      m_cached_files.size(), processing_halted,
+      [this](size_t i) {
+        std::shared_ptr<GameFile> file = m_cached_files[i];
+        return UpdateAdditionalMetadata(&file, false) ? file : nullptr;
+      },
+      [&](size_t i, std::shared_ptr<GameFile> file) {
+        if (!file)
+          return;
+
+        cache_changed = true;
+        m_cached_files[i] = std::move(file);
+        if (game_updated)
+          game_updated(m_cached_files[i]);
+      });
+
   return cache_changed;
 }
 
-bool GameFileCache::UpdateAdditionalMetadata(std::shared_ptr<GameFile>* game_file)
+bool GameFileCache::UpdateAdditionalMetadata(std::shared_ptr<GameFile>* game_file,
+                                             bool download_cover)
 {
   const bool xml_metadata_changed = (*game_file)->XMLMetadataChanged();
   const bool wii_banner_changed = (*game_file)->WiiBannerChanged();
   const bool custom_banner_changed = (*game_file)->CustomBannerChanged();
 
-  (*game_file)->DownloadDefaultCover();
+  if (download_cover)
+    (*game_file)->DownloadDefaultCover();
 
   const bool default_cover_changed = (*game_file)->DefaultCoverChanged();
   const bool custom_cover_changed = (*game_file)->CustomCoverChanged();
@@ -241,10 +347,13 @@ bool GameFileCache::SyncCacheFile(bool save)
   }
   else
   {
-    std::vector<u8> buffer(f.GetSize());
-    if (!buffer.empty() && f.ReadBytes(buffer.data(), buffer.size()))
+    // The cache is read straight from a mapping of the file instead of being copied to a buffer
+    // first. PointerWrap doesn't write to the buffer in read mode.
+    File::MappedFile mapping;
+    if (mapping.Map(f))
     {
-      u8* ptr = buffer.data();
+      const std::span<const u8> buffer = mapping.GetSpan();
+      u8* ptr = const_cast<u8*>(buffer.data());
       PointerWrap p(&ptr, buffer.size(), PointerWrap::Mode::Read);
       DoState(&p, buffer.size());
       if (p.IsReadMode())
@@ -16,6 +16,12 @@
 #include "VideoCommon/BPMemory.h"
 #include "VideoCommon/TextureDecoder.h"
 
+#if defined(_M_X86_64)
+#include <emmintrin.h>
+#elif defined(_M_ARM_64)
+#include <arm_neon.h>
+#endif
+
 #define ALLOW_MIPMAP 1
 
 namespace TextureSampler
@@ -70,6 +76,43 @@ static inline void AddTexel(const u8* inTexel, u32* outTexel, u32 fract)
   outTexel[3] += inTexel[3] * fract;
 }
 
+// Computes the weighted sum of the four RGBA texels of a bilinear footprint, one channel per
+// output element. The weights add up to at most 128 * 128, so the sums can't overflow.
+static inline void FilterTexels(const u8 (&texels)[4][4], const u16 (&weights)[4], u32* outTexel)
+{
+#if defined(_M_X86_64)
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i all = _mm_loadu_si128(reinterpret_cast<const __m128i*>(texels));
+  const __m128i texels_01 = _mm_unpacklo_epi8(all, zero);
+  const __m128i texels_23 = _mm_unpackhi_epi8(all, zero);
+
+  // Interleave the channels of texel pairs so that each 32-bit lane holds one channel of both.
+  const __m128i pairs_01 = _mm_unpacklo_epi16(texels_01, _mm_srli_si128(texels_01, 8));
+  const __m128i pairs_23 = _mm_unpacklo_epi16(texels_23, _mm_srli_si128(texels_23, 8));
+  const __m128i weights_01 = _mm_set1_epi32(weights[0] | (weights[1] << 16));
+  const __m128i weights_23 = _mm_set1_epi32(weights[2] | (weights[3] << 16));
+
+  const __m128i sum =
+      _mm_add_epi32(_mm_madd_epi16(pairs_01, weights_01), _mm_madd_epi16(pairs_23, weights_23));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(outTexel), sum);
+#elif defined(_M_ARM_64)
+  const uint8x16_t all = vld1q_u8(&texels[0][0]);
+  const uint16x8_t texels_01 = vmovl_u8(vget_low_u8(all));
+  const uint16x8_t texels_23 = vmovl_u8(vget_high_u8(all));
+
+  uint32x4_t sum = vmull_n_u16(vget_low_u16(texels_01), weights[0]);
+  sum = vmlal_n_u16(sum, vget_high_u16(texels_01), weights[1]);
+  sum = vmlal_n_u16(sum, vget_low_u16(texels_23), weights[2]);
+  sum = vmlal_n_u16(sum, vget_high_u16(texels_23), weights[3]);
+  vst1q_u32(outTexel, sum);
+#else
+  SetTexel(texels[0], outTexel, weights[0]);
+  AddTexel(texels[1], outTexel, weights[1]);
+  AddTexel(texels[2], outTexel, weights[2]);
+  AddTexel(texels[3], outTexel, weights[3]);
+#endif
+}
+
 void Sample(s32 s, s32 t, s32 lod, bool linear, u8 texmap, u8* sample)
 {
   int baseMip = 0;
@@ -194,51 +237,45 @@ void SampleMip(s32 s, s32 t, s32 mip, bool linear, u8 texmap, u8* sample)
     int imageTPlus1 = imageT + 1;
     const int fractT = t & 0x7f;
 
-    u8 sampledTex[4];
-    u32 texel[4];
-
     WrapCoord(&imageS, tm0.wrap_s, image_width_minus_1 + 1);
     WrapCoord(&imageT, tm0.wrap_t, image_height_minus_1 + 1);
     WrapCoord(&imageSPlus1, tm0.wrap_s, image_width_minus_1 + 1);
     WrapCoord(&imageTPlus1, tm0.wrap_t, image_height_minus_1 + 1);
 
+    // Decode the whole 2x2 footprint first, then filter all channels of it at once.
+    u8 sampledTex[4][4];
     if (!(texfmt == TextureFormat::RGBA8 && texUnit.texImage1.cache_manually_managed))
     {
-      TexDecoder_DecodeTexel(sampledTex, image_src, imageS, imageT, image_width_minus_1, texfmt,
+      TexDecoder_DecodeTexel(sampledTex[0], image_src, imageS, imageT, image_width_minus_1, texfmt,
                              tlut, tlutfmt);
-      SetTexel(sampledTex, texel, (128 - fractS) * (128 - fractT));
-
-      TexDecoder_DecodeTexel(sampledTex, image_src, imageSPlus1, imageT, image_width_minus_1,
+      TexDecoder_DecodeTexel(sampledTex[1], image_src, imageSPlus1, imageT, image_width_minus_1,
                              texfmt, tlut, tlutfmt);
-      AddTexel(sampledTex, texel, (fractS) * (128 - fractT));
-
-      TexDecoder_DecodeTexel(sampledTex, image_src, imageS, imageTPlus1, image_width_minus_1,
+      TexDecoder_DecodeTexel(sampledTex[2], image_src, imageS, imageTPlus1, image_width_minus_1,
                              texfmt, tlut, tlutfmt);
-      AddTexel(sampledTex, texel, (128 - fractS) * (fractT));
-
-      TexDecoder_DecodeTexel(sampledTex, image_src, imageSPlus1, imageTPlus1, image_width_minus_1,
-                             texfmt, tlut, tlutfmt);
-      AddTexel(sampledTex, texel, (fractS) * (fractT));
+      TexDecoder_DecodeTexel(sampledTex[3], image_src, imageSPlus1, imageTPlus1,
+                             image_width_minus_1, texfmt, tlut, tlutfmt);
     }
     else
     {
-      TexDecoder_DecodeTexelRGBA8FromTmem(sampledTex, image_src, image_src_odd, imageS, imageT,
-                                          image_width_minus_1);
-      SetTexel(sampledTex, texel, (128 - fractS) * (128 - fractT));
-
-      TexDecoder_DecodeTexelRGBA8FromTmem(sampledTex, image_src, image_src_odd, imageSPlus1, imageT,
-                                          image_width_minus_1);
-      AddTexel(sampledTex, texel, (fractS) * (128 - fractT));
-
-      TexDecoder_DecodeTexelRGBA8FromTmem(sampledTex, image_src, image_src_odd, imageS, imageTPlus1,
+      TexDecoder_DecodeTexelRGBA8FromTmem(sampledTex[0], image_src, image_src_odd, imageS, imageT,
                                           image_width_minus_1);
-      AddTexel(sampledTex, texel, (128 - fractS) * (fractT));
-
-      TexDecoder_DecodeTexelRGBA8FromTmem(sampledTex, image_src, image_src_odd, imageSPlus1,
+      TexDecoder_DecodeTexelRGBA8FromTmem(sampledTex[1], image_src, image_src_odd, imageSPlus1,
+                                          imageT, image_width_minus_1);
+      TexDecoder_DecodeTexelRGBA8FromTmem(sampledTex[2], image_src, image_src_odd, imageS,
+                                          imageTPlus1, image_width_minus_1);
+      TexDecoder_DecodeTexelRGBA8FromTmem(sampledTex[3], image_src, image_src_odd, imageSPlus1,
                                           imageTPlus1, image_width_minus_1);
-      AddTexel(sampledTex, texel, (fractS) * (fractT));
     }
 
+    const u16 weights[4] = {
+        static_cast<u16>((128 - fractS) * (128 - fractT)),
+        static_cast<u16>(fractS * (128 - fractT)),
+        static_cast<u16>((128 - fractS) * fractT),
+        static_cast<u16>(fractS * fractT),
+    };
+    u32 texel[4];
+    FilterTexels(sampledTex, weights, texel);
+
     sample[0] = (u8)(texel[0] >> 14);
     sample[1] = (u8)(texel[1] >> 14);
     sample[2] = (u8)(texel[2] >> 14);
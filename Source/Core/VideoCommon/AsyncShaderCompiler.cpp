@@ -3,6 +3,7 @@
 
 #include "VideoCommon/AsyncShaderCompiler.h"
 
+#include <iterator>
 #include <thread>
 
 #include "Common/Assert.h"
@@ -56,10 +57,25 @@ void AsyncShaderCompiler::RetrieveWorkItems()
   }
 }
 
-bool AsyncShaderCompiler::HasPendingWork()
+size_t AsyncShaderCompiler::CountPendingWork(u32 max_priority) const
+{
+  const auto pending_end = m_pending_work.upper_bound(max_priority);
+  const auto busy_end = m_busy_work_priorities.upper_bound(max_priority);
+  return static_cast<size_t>(std::distance(m_pending_work.begin(), pending_end) +
+                             std::distance(m_busy_work_priorities.begin(), busy_end));
+}
+
+bool AsyncShaderCompiler::HasPendingWork(u32 max_priority)
+{
+  std::lock_guard<std::mutex> guard(m_pending_work_lock);
+  return (!m_pending_work.empty() && m_pending_work.begin()->first <= max_priority) ||
+         (!m_busy_work_priorities.empty() && *m_busy_work_priorities.begin() <= max_priority);
+}
+
+size_t AsyncShaderCompiler::GetPendingWorkCount()
 {
   std::lock_guard<std::mutex> guard(m_pending_work_lock);
-  return !m_pending_work.empty() || m_busy_workers.load() != 0;
+  return m_pending_work.size() + m_busy_work_priorities.size();
 }
 
 bool AsyncShaderCompiler::HasCompletedWork()
@@ -69,9 +85,9 @@ bool AsyncShaderCompiler::HasCompletedWork()
 }
 
 bool AsyncShaderCompiler::WaitUntilCompletion(
-    const std::function<void(size_t, size_t)>& progress_callback)
+    const std::function<void(size_t, size_t)>& progress_callback, u32 max_priority)
 {
-  if (!HasPendingWork())
+  if (!HasPendingWork(max_priority))
     return true;
 
   // Wait a second before opening a progress dialog.
@@ -81,7 +97,7 @@ bool AsyncShaderCompiler::WaitUntilCompletion(
   for (u32 i = 0; i < (1000 / CHECK_INTERVAL_MS); i++)
   {
     std::this_thread::sleep_for(std::chrono::milliseconds(CHECK_INTERVAL));
-    if (!HasPendingWork())
+    if (!HasPendingWork(max_priority))
       return true;
   }
 
@@ -91,7 +107,7 @@ bool AsyncShaderCompiler::WaitUntilCompletion(
     // Safe to hold both locks here, since nowhere else does.
     std::lock_guard<std::mutex> pending_guard(m_pending_work_lock);
     std::lock_guard<std::mutex> completed_guard(m_completed_work_lock);
-    total_items = m_completed_work.size() + m_pending_work.size() + m_busy_workers.load() + 1;
+    total_items = m_completed_work.size() + CountPendingWork(max_priority) + 1;
   }
 
   // Update progress while the compiles complete.
@@ -100,9 +116,9 @@ bool AsyncShaderCompiler::WaitUntilCompletion(
     size_t remaining_items;
     {
       std::lock_guard<std::mutex> pending_guard(m_pending_work_lock);
-      if (m_pending_work.empty() && !m_busy_workers.load())
+      remaining_items = CountPendingWork(max_priority);
+      if (remaining_items == 0)
         return true;
-      remaining_items = m_pending_work.size();
     }
 
     progress_callback(total_items - remaining_items, total_items);
@@ -220,8 +236,8 @@ void AsyncShaderCompiler::WorkerThreadRun()
 
     while (!m_pending_work.empty() && !m_exit_flag.IsSet())
     {
-      m_busy_workers++;
       auto iter = m_pending_work.begin();
+      const auto busy_iter = m_busy_work_priorities.insert(iter->first);
       WorkItemPtr item(std::move(iter->second));
       m_pending_work.erase(iter);
       pending_lock.unlock();
@@ -233,7 +249,7 @@ void AsyncShaderCompiler::WorkerThreadRun()
       }
 
       pending_lock.lock();
-      m_busy_workers--;
+      m_busy_work_priorities.erase(busy_iter);
     }
   }
 }
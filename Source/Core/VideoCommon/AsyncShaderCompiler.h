@@ -7,9 +7,11 @@
 #include <condition_variable>
 #include <deque>
 #include <functional>
+#include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <set>
 #include <thread>
 #include <utility>
 #include <vector>
@@ -46,12 +48,19 @@ public:
   // this work item will be compiled, relative to the other work items.
   void QueueWorkItem(WorkItemPtr item, u32 priority);
   void RetrieveWorkItems();
-  bool HasPendingWork();
+
+  // Only considers work items with a priority value of at most max_priority.
+  bool HasPendingWork(u32 max_priority = std::numeric_limits<u32>::max());
   bool HasCompletedWork();
 
+  // Number of work items which are queued or being compiled.
+  size_t GetPendingWorkCount();
+
   // Calls progress_callback periodically, with completed_items, and total_items.
+  // Work items with a priority value above max_priority are not waited for.
   // Returns false if interrupted.
-  bool WaitUntilCompletion(const std::function<void(size_t, size_t)>& progress_callback);
+  bool WaitUntilCompletion(const std::function<void(size_t, size_t)>& progress_callback,
+                           u32 max_priority = std::numeric_limits<u32>::max());
 
   // Needed because of calling virtual methods in shutdown procedure.
   bool StartWorkerThreads(u32 num_worker_threads);
@@ -68,6 +77,9 @@ private:
   void WorkerThreadEntryPoint(void* param);
   void WorkerThreadRun();
 
+  // Must be called with m_pending_work_lock held.
+  size_t CountPendingWork(u32 max_priority) const;
+
   Common::Flag m_exit_flag;
   Common::Event m_init_event;
 
@@ -79,7 +91,9 @@ private:
   std::multimap<u32, WorkItemPtr> m_pending_work;
   std::mutex m_pending_work_lock;
   std::condition_variable m_worker_thread_wake;
-  std::atomic_size_t m_busy_workers{0};
+
+  // Priorities of the work items that are being compiled by the worker threads.
+  std::multiset<u32> m_busy_work_priorities;
 
   std::deque<WorkItemPtr> m_completed_work;
   std::mutex m_completed_work_lock;
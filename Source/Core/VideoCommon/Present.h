@@ -93,6 +93,8 @@ public:
   void SetMousePress(u32 button_mask);
 
   int FrameCount() const { return m_frame_count; }
+  // Emulated time of the last XFB copy that was presented, in CPU ticks
+  u64 LastXFBTicks() const { return m_last_xfb_ticks; }
 
   void DoState(PointerWrap& p);
 
@@ -3,12 +3,17 @@
 
 #include "VideoCommon/ShaderCache.h"
 
+#include <algorithm>
+#include <limits>
+
 #include <fmt/format.h>
 
 #include "Common/Assert.h"
 #include "Common/FileUtil.h"
 #include "Common/MsgHandler.h"
 #include "Core/ConfigManager.h"
+#include "Core/HW/SystemTimers.h"
+#include "Core/System.h"
 
 #include "VideoCommon/AbstractGfx.h"
 #include "VideoCommon/ConstantManager.h"
@@ -66,10 +71,16 @@ void ShaderCache::InitializeShaderCache()
   if (g_ActiveConfig.UsingUberShaders())
     QueueUberShaderPipelines();
 
-  // Compile all known UIDs.
-  CompileMissingPipelines();
+  // Compile all known UIDs. If they can finish compiling in the background, only wait for the
+  // pipelines which previous sessions needed soon after booting.
+  const u32 startup_priority = CompileMissingPipelines();
   if (g_ActiveConfig.bWaitForShadersBeforeStarting)
-    WaitForAsyncCompiler();
+  {
+    if (g_ActiveConfig.iWaitForShadersSeconds > 0 && g_ActiveConfig.GetShaderCompilerThreads() > 0)
+      WaitForAsyncCompiler(startup_priority);
+    else
+      WaitForAsyncCompiler();
+  }
 
   // Switch to the runtime shader compiler thread configuration.
   m_async_shader_compiler->ResizeWorkerThreads(g_ActiveConfig.GetShaderCompilerThreads());
@@ -102,6 +113,8 @@ void ShaderCache::Reload()
 void ShaderCache::RetrieveAsyncShaders()
 {
   m_async_shader_compiler->RetrieveWorkItems();
+  SETSTAT(g_stats.num_pending_shader_compiles,
+          static_cast<int>(m_async_shader_compiler->GetPendingWorkCount()));
 }
 
 void ShaderCache::Shutdown()
@@ -117,17 +130,26 @@ void ShaderCache::Shutdown()
 const AbstractPipeline* ShaderCache::GetPipelineForUid(const GXPipelineUid& uid)
 {
   auto it = m_gx_pipeline_cache.find(uid);
-  if (it != m_gx_pipeline_cache.end() && !it->second.second)
-    return it->second.first.get();
+  if (it != m_gx_pipeline_cache.end() && !it->second.pending)
+  {
+    RecordGXPipelineUse(it->second);
+    return it->second.pipeline.get();
+  }
 
   const bool exists_in_cache = it != m_gx_pipeline_cache.end();
+  if (g_ActiveConfig.bShaderCache && !exists_in_cache)
+    AppendGXPipelineUID(uid);
+  RecordGXPipelineUse(m_gx_pipeline_cache[uid]);
+
   std::unique_ptr<AbstractPipeline> pipeline;
+  std::vector<u8> cache_data;
   std::optional<AbstractPipelineConfig> pipeline_config = GetGXPipelineConfig(uid);
   if (pipeline_config)
-    pipeline = g_gfx->CreatePipeline(*pipeline_config);
-  if (g_ActiveConfig.bShaderCache && !exists_in_cache)
-    AppendGXPipelineUID(uid);
-  return InsertGXPipeline(uid, std::move(pipeline));
+  {
+    cache_data = LookupPipelineCacheData(uid);
+    pipeline = CreatePipeline(*pipeline_config, &cache_data);
+  }
+  return InsertGXPipeline(uid, std::move(pipeline), !cache_data.empty());
 }
 
 std::optional<const AbstractPipeline*> ShaderCache::GetPipelineForUidAsync(const GXPipelineUid& uid)
@@ -135,14 +157,15 @@ std::optional<const AbstractPipeline*> ShaderCache::GetPipelineForUidAsync(const
   auto it = m_gx_pipeline_cache.find(uid);
   if (it != m_gx_pipeline_cache.end())
   {
-    // .second is the pending flag, i.e. compiling in the background.
-    if (!it->second.second)
-      return it->second.first.get();
+    RecordGXPipelineUse(it->second);
+    if (!it->second.pending)
+      return it->second.pipeline.get();
     else
       return {};
   }
 
   AppendGXPipelineUID(uid);
+  RecordGXPipelineUse(m_gx_pipeline_cache[uid]);
   QueuePipelineCompile(uid, COMPILE_PRIORITY_ONDEMAND_PIPELINE);
   return {};
 }
@@ -150,17 +173,21 @@ std::optional<const AbstractPipeline*> ShaderCache::GetPipelineForUidAsync(const
 const AbstractPipeline* ShaderCache::GetUberPipelineForUid(const GXUberPipelineUid& uid)
 {
   auto it = m_gx_uber_pipeline_cache.find(uid);
-  if (it != m_gx_uber_pipeline_cache.end() && !it->second.second)
-    return it->second.first.get();
+  if (it != m_gx_uber_pipeline_cache.end() && !it->second.pending)
+    return it->second.pipeline.get();
 
   std::unique_ptr<AbstractPipeline> pipeline;
+  std::vector<u8> cache_data;
   std::optional<AbstractPipelineConfig> pipeline_config = GetGXPipelineConfig(uid);
   if (pipeline_config)
-    pipeline = g_gfx->CreatePipeline(*pipeline_config);
-  return InsertGXUberPipeline(uid, std::move(pipeline));
+  {
+    cache_data = LookupPipelineCacheData(uid);
+    pipeline = CreatePipeline(*pipeline_config, &cache_data);
+  }
+  return InsertGXUberPipeline(uid, std::move(pipeline), !cache_data.empty());
 }
 
-void ShaderCache::WaitForAsyncCompiler()
+void ShaderCache::WaitForAsyncCompiler(u32 max_priority)
 {
   bool running = true;
 
@@ -187,10 +214,13 @@ void ShaderCache::WaitForAsyncCompiler()
     g_presenter->Present();
   };
 
-  while (running &&
-         (m_async_shader_compiler->HasPendingWork() || m_async_shader_compiler->HasCompletedWork()))
+  // Work items above max_priority are left to complete in the background, so their completion
+  // can't be waited for either.
+  const bool wait_for_all = max_priority == std::numeric_limits<u32>::max();
+  while (running && (m_async_shader_compiler->HasPendingWork(max_priority) ||
+                     (wait_for_all && m_async_shader_compiler->HasCompletedWork())))
   {
-    running = m_async_shader_compiler->WaitUntilCompletion(update_ui_progress);
+    running = m_async_shader_compiler->WaitUntilCompletion(update_ui_progress, max_priority);
 
     m_async_shader_compiler->RetrieveWorkItems();
   }
@@ -225,46 +255,54 @@ static void UnserializePipelineUid(const SerializedUidType& uid, UidType& real_u
   real_uid.blending_state.hex = uid.blending_state_bits;
 }
 
-template <ShaderStage stage, typename K, typename T>
+template <typename T>
 void ShaderCache::LoadShaderCache(T& cache, APIType api_type, const char* type, bool include_gameid)
 {
-  class CacheReader : public Common::LinearDiskCacheReader<K, u8>
-  {
-  public:
-    CacheReader(T& cache_) : cache(cache_) {}
-    void Read(const K& key, const u8* value, u32 value_size) override
-    {
-      auto shader = g_gfx->CreateShaderFromBinary(stage, value, value_size);
-      if (shader)
-      {
-        auto& entry = cache.shader_map[key];
-        entry.shader = std::move(shader);
-        entry.pending = false;
+  // Shaders are only created from the cached binaries when they are first needed, see FindShader.
+  std::string filename = GetDiskShaderCacheFileName(api_type, type, include_gameid, true);
+  u32 count = cache.disk_cache.Open(filename);
+  INFO_LOG_FMT(VIDEO, "Opened {} with {} cached shaders", filename, count);
+}
 
-        switch (stage)
-        {
-        case ShaderStage::Vertex:
-          INCSTAT(g_stats.num_vertex_shaders_created);
-          INCSTAT(g_stats.num_vertex_shaders_alive);
-          break;
-        case ShaderStage::Pixel:
-          INCSTAT(g_stats.num_pixel_shaders_created);
-          INCSTAT(g_stats.num_pixel_shaders_alive);
-          break;
-        default:
-          break;
-        }
-      }
-    }
+// Returns the shader for the UID, creating it from the shader disk cache if it was compiled before.
+// Returns shader_map.end() if the shader still needs to be compiled.
+template <ShaderStage stage, typename T, typename Uid>
+static auto FindShader(T& cache, const Uid& uid)
+{
+  auto iter = cache.shader_map.find(uid);
+  if (iter != cache.shader_map.end())
+    return iter;
 
-  private:
-    T& cache;
-  };
+  const std::optional<std::vector<u8>> binary = cache.disk_cache.Lookup(uid);
+  if (!binary)
+    return iter;
 
-  std::string filename = GetDiskShaderCacheFileName(api_type, type, include_gameid, true);
-  CacheReader reader(cache);
-  u32 count = cache.disk_cache.OpenAndRead(filename, reader);
-  INFO_LOG_FMT(VIDEO, "Loaded {} cached shaders from {}", count, filename);
+  auto shader = g_gfx->CreateShaderFromBinary(stage, binary->data(), binary->size());
+  if (!shader)
+  {
+    // Most likely the binary is from a different driver version. Drop it, so that it is replaced
+    // by the binary of the newly compiled shader.
+    cache.disk_cache.Erase(uid);
+    return iter;
+  }
+
+  switch (stage)
+  {
+  case ShaderStage::Vertex:
+    INCSTAT(g_stats.num_vertex_shaders_created);
+    INCSTAT(g_stats.num_vertex_shaders_alive);
+    break;
+  case ShaderStage::Pixel:
+    INCSTAT(g_stats.num_pixel_shaders_created);
+    INCSTAT(g_stats.num_pixel_shaders_alive);
+    break;
+  default:
+    break;
+  }
+
+  iter = cache.shader_map.try_emplace(uid).first;
+  iter->second.shader = std::move(shader);
+  return iter;
 }
 
 template <typename T>
@@ -275,64 +313,45 @@ void ShaderCache::ClearShaderCache(T& cache)
   cache.shader_map.clear();
 }
 
-template <typename KeyType, typename DiskKeyType, typename T>
-void ShaderCache::LoadPipelineCache(T& cache, Common::LinearDiskCache<DiskKeyType, u8>& disk_cache,
+template <typename DiskKeyType>
+void ShaderCache::LoadPipelineCache(Common::IndexedDiskCache<DiskKeyType, u8>& disk_cache,
                                     APIType api_type, const char* type, bool include_gameid)
 {
-  class CacheReader : public Common::LinearDiskCacheReader<DiskKeyType, u8>
-  {
-  public:
-    CacheReader(ShaderCache* this_ptr_, T& cache_) : this_ptr(this_ptr_), cache(cache_) {}
-    bool AnyFailed() const { return failed; }
-    void Read(const DiskKeyType& key, const u8* value, u32 value_size) override
-    {
-      KeyType real_uid;
-      UnserializePipelineUid(key, real_uid);
-
-      // Skip those which are already compiled.
-      if (failed || cache.contains(real_uid))
-        return;
-
-      auto config = this_ptr->GetGXPipelineConfig(real_uid);
-      if (!config)
-        return;
-
-      auto pipeline = g_gfx->CreatePipeline(*config, value, value_size);
-      if (!pipeline)
-      {
-        // If any of the pipelines fail to create, consider the cache stale.
-        failed = true;
-        return;
-      }
+  // Pipelines are only created from the cached data when they are first needed.
+  std::string filename = GetDiskShaderCacheFileName(api_type, type, include_gameid, true);
+  const u32 count = disk_cache.Open(filename);
+  INFO_LOG_FMT(VIDEO, "Opened {} with {} cached pipelines", filename, count);
+}
 
-      auto& entry = cache[real_uid];
-      entry.first = std::move(pipeline);
-      entry.second = false;
-    }
+std::vector<u8> ShaderCache::LookupPipelineCacheData(const GXPipelineUid& uid)
+{
+  SerializedGXPipelineUid disk_uid;
+  SerializePipelineUid(uid, disk_uid);
+  return m_gx_pipeline_disk_cache.Lookup(disk_uid).value_or(std::vector<u8>());
+}
 
-  private:
-    ShaderCache* this_ptr;
-    T& cache;
-    bool failed = false;
-  };
+std::vector<u8> ShaderCache::LookupPipelineCacheData(const GXUberPipelineUid& uid)
+{
+  SerializedGXUberPipelineUid disk_uid;
+  SerializePipelineUid(uid, disk_uid);
+  return m_gx_uber_pipeline_disk_cache.Lookup(disk_uid).value_or(std::vector<u8>());
+}
 
-  std::string filename = GetDiskShaderCacheFileName(api_type, type, include_gameid, true);
-  CacheReader reader(this, cache);
-  const u32 count = disk_cache.OpenAndRead(filename, reader);
-  INFO_LOG_FMT(VIDEO, "Loaded {} cached pipelines from {}", count, filename);
-
-  // If any of the pipelines in the cache failed to create, it's likely because of a change of
-  // driver version, or system configuration. In this case, when the UID cache picks up the pipeline
-  // later on, we'll write a duplicate entry to the pipeline cache. There's also no point in keeping
-  // the old cache data around, so discard and recreate the disk cache.
-  if (reader.AnyFailed())
+std::unique_ptr<AbstractPipeline> ShaderCache::CreatePipeline(const AbstractPipelineConfig& config,
+                                                              std::vector<u8>* cache_data)
+{
+  if (!cache_data->empty())
   {
-    WARN_LOG_FMT(VIDEO, "Failed to load one or more pipelines from cache '{}'. Discarding.",
-                 filename);
-    disk_cache.Close();
-    File::Delete(filename);
-    disk_cache.OpenAndRead(filename, reader);
+    auto pipeline = g_gfx->CreatePipeline(config, cache_data->data(), cache_data->size());
+    if (pipeline)
+      return pipeline;
+
+    // The data is stale, likely because of a change of driver version or system configuration.
+    // Clearing it makes the pipeline's data be written to the disk cache again once it's created.
+    cache_data->clear();
   }
+
+  return g_gfx->CreatePipeline(config);
 }
 
 template <typename T, typename Y>
@@ -344,8 +363,8 @@ void ShaderCache::ClearPipelineCache(T& cache, Y& disk_cache)
   // Set the pending flag to false, and destroy the pipeline.
   for (auto& it : cache)
   {
-    it.second.first.reset();
-    it.second.second = false;
+    it.second.pipeline.reset();
+    it.second.pending = false;
   }
 }
 
@@ -354,30 +373,22 @@ void ShaderCache::LoadCaches()
   // Ubershader caches, if present.
   if (g_ActiveConfig.backend_info.bSupportsShaderBinaries)
   {
-    LoadShaderCache<ShaderStage::Vertex, UberShader::VertexShaderUid>(m_uber_vs_cache, m_api_type,
-                                                                      "uber-vs", false);
-    LoadShaderCache<ShaderStage::Pixel, UberShader::PixelShaderUid>(m_uber_ps_cache, m_api_type,
-                                                                    "uber-ps", false);
+    LoadShaderCache(m_uber_vs_cache, m_api_type, "uber-vs", false);
+    LoadShaderCache(m_uber_ps_cache, m_api_type, "uber-ps", false);
 
     // We also share geometry shaders, as there aren't many variants.
     if (m_host_config.backend_geometry_shaders)
-      LoadShaderCache<ShaderStage::Geometry, GeometryShaderUid>(m_gs_cache, m_api_type, "gs",
-                                                                false);
+      LoadShaderCache(m_gs_cache, m_api_type, "gs", false);
 
     // Specialized shaders, gameid-specific.
-    LoadShaderCache<ShaderStage::Vertex, VertexShaderUid>(m_vs_cache, m_api_type, "specialized-vs",
-                                                          true);
-    LoadShaderCache<ShaderStage::Pixel, PixelShaderUid>(m_ps_cache, m_api_type, "specialized-ps",
-                                                        true);
+    LoadShaderCache(m_vs_cache, m_api_type, "specialized-vs", true);
+    LoadShaderCache(m_ps_cache, m_api_type, "specialized-ps", true);
   }
 
   if (g_ActiveConfig.backend_info.bSupportsPipelineCacheData)
   {
-    LoadPipelineCache<GXPipelineUid, SerializedGXPipelineUid>(
-        m_gx_pipeline_cache, m_gx_pipeline_disk_cache, m_api_type, "specialized-pipeline", true);
-    LoadPipelineCache<GXUberPipelineUid, SerializedGXUberPipelineUid>(
-        m_gx_uber_pipeline_cache, m_gx_uber_pipeline_disk_cache, m_api_type, "uber-pipeline",
-        false);
+    LoadPipelineCache(m_gx_pipeline_disk_cache, m_api_type, "specialized-pipeline", true);
+    LoadPipelineCache(m_gx_uber_pipeline_disk_cache, m_api_type, "uber-pipeline", false);
   }
 }
 
@@ -413,21 +424,74 @@ void ShaderCache::ClearCaches()
   SETSTAT(g_stats.num_pixel_shaders_alive, 0);
   SETSTAT(g_stats.num_vertex_shaders_created, 0);
   SETSTAT(g_stats.num_vertex_shaders_alive, 0);
+  SETSTAT(g_stats.num_pipeline_cache_hits, 0);
+  SETSTAT(g_stats.num_pipeline_cache_misses, 0);
 }
 
-void ShaderCache::CompileMissingPipelines()
+u32 ShaderCache::CompileMissingPipelines()
 {
-  // Queue all uids with a null pipeline for compilation.
+  // Queue all uids with a null pipeline for compilation. Pipelines are ordered by the frame on
+  // which previous sessions first needed them, so that those needed right after booting are
+  // compiled first, and pipelines without a usage history come last.
+  std::vector<std::pair<const GXPipelineUid*, const PipelineUsage*>> missing_pipelines;
   for (auto& it : m_gx_pipeline_cache)
   {
-    if (!it.second.first)
-      QueuePipelineCompile(it.first, COMPILE_PRIORITY_SHADERCACHE_PIPELINE);
+    if (!it.second.pipeline)
+      missing_pipelines.emplace_back(&it.first, &it.second.usage);
   }
+  std::stable_sort(missing_pipelines.begin(), missing_pipelines.end(),
+                   [](const auto& lhs, const auto& rhs) {
+                     const PipelineUsage& a = *lhs.second;
+                     const PipelineUsage& b = *rhs.second;
+                     if ((a.num_sessions == 0) != (b.num_sessions == 0))
+                       return a.num_sessions != 0;
+                     if (a.first_use_ms != b.first_use_ms)
+                       return a.first_use_ms < b.first_use_ms;
+                     return a.num_sessions > b.num_sessions;
+                   });
+
+  const u32 startup_ms =
+      static_cast<u32>(std::clamp(g_ActiveConfig.iWaitForShadersSeconds, 0, 24 * 60 * 60)) * 1000;
+  bool has_usage_history = false;
+  u32 startup_priority = COMPILE_PRIORITY_UBERSHADER_PIPELINE;
+  u32 priority = COMPILE_PRIORITY_SHADERCACHE_PIPELINE;
+  for (const auto& [uid, usage] : missing_pipelines)
+  {
+    if (usage->num_sessions != 0)
+    {
+      has_usage_history = true;
+      if (usage->first_use_ms < startup_ms)
+        startup_priority = priority;
+    }
+    QueuePipelineCompile(*uid, priority++);
+  }
+
   for (auto& it : m_gx_uber_pipeline_cache)
   {
-    if (!it.second.first)
+    if (!it.second.pipeline)
       QueueUberPipelineCompile(it.first, COMPILE_PRIORITY_UBERSHADER_PIPELINE);
   }
+
+  // Without any usage history, there's no telling which pipelines are needed first.
+  return has_usage_history ? startup_priority : std::numeric_limits<u32>::max();
+}
+
+void ShaderCache::RecordGXPipelineUse(PipelineCacheEntry& entry)
+{
+  if (entry.used)
+    return;
+
+  if (entry.pipeline && !entry.pending)
+    INCSTAT(g_stats.num_pipeline_cache_hits);
+  else
+    INCSTAT(g_stats.num_pipeline_cache_misses);
+
+  entry.used = true;
+  const u64 ticks_per_ms =
+      std::max<u64>(Core::System::GetInstance().GetSystemTimers().GetTicksPerSecond() / 1000, 1);
+  entry.usage.first_use_ms = static_cast<u32>(
+      std::min<u64>(g_presenter->LastXFBTicks() / ticks_per_ms, std::numeric_limits<u32>::max()));
+  entry.usage.num_sessions++;
 }
 
 std::unique_ptr<AbstractShader> ShaderCache::CompileVertexShader(const VertexShaderUid& uid) const
@@ -742,7 +806,7 @@ ShaderCache::GetGXPipelineConfig(const GXPipelineUid& config_in)
 {
   GXPipelineUid config = ApplyDriverBugs(config_in);
   const AbstractShader* vs;
-  auto vs_iter = m_vs_cache.shader_map.find(config.vs_uid);
+  auto vs_iter = FindShader<ShaderStage::Vertex>(m_vs_cache, config.vs_uid);
   if (vs_iter != m_vs_cache.shader_map.end() && !vs_iter->second.pending)
     vs = vs_iter->second.shader.get();
   else
@@ -752,7 +816,7 @@ ShaderCache::GetGXPipelineConfig(const GXPipelineUid& config_in)
   ClearUnusedPixelShaderUidBits(m_api_type, m_host_config, &ps_uid);
 
   const AbstractShader* ps;
-  auto ps_iter = m_ps_cache.shader_map.find(ps_uid);
+  auto ps_iter = FindShader<ShaderStage::Pixel>(m_ps_cache, ps_uid);
   if (ps_iter != m_ps_cache.shader_map.end() && !ps_iter->second.pending)
     ps = ps_iter->second.shader.get();
   else
@@ -764,7 +828,7 @@ ShaderCache::GetGXPipelineConfig(const GXPipelineUid& config_in)
   const AbstractShader* gs = nullptr;
   if (NeedsGeometryShader(config.gs_uid))
   {
-    auto gs_iter = m_gs_cache.shader_map.find(config.gs_uid);
+    auto gs_iter = FindShader<ShaderStage::Geometry>(m_gs_cache, config.gs_uid);
     if (gs_iter != m_gs_cache.shader_map.end() && !gs_iter->second.pending)
       gs = gs_iter->second.shader.get();
     else
@@ -833,7 +897,7 @@ ShaderCache::GetGXPipelineConfig(const GXUberPipelineUid& config_in)
 {
   GXUberPipelineUid config = ApplyDriverBugs(config_in);
   const AbstractShader* vs;
-  auto vs_iter = m_uber_vs_cache.shader_map.find(config.vs_uid);
+  auto vs_iter = FindShader<ShaderStage::Vertex>(m_uber_vs_cache, config.vs_uid);
   if (vs_iter != m_uber_vs_cache.shader_map.end() && !vs_iter->second.pending)
     vs = vs_iter->second.shader.get();
   else
@@ -843,7 +907,7 @@ ShaderCache::GetGXPipelineConfig(const GXUberPipelineUid& config_in)
   UberShader::ClearUnusedPixelShaderUidBits(m_api_type, m_host_config, &ps_uid);
 
   const AbstractShader* ps;
-  auto ps_iter = m_uber_ps_cache.shader_map.find(ps_uid);
+  auto ps_iter = FindShader<ShaderStage::Pixel>(m_uber_ps_cache, ps_uid);
   if (ps_iter != m_uber_ps_cache.shader_map.end() && !ps_iter->second.pending)
     ps = ps_iter->second.shader.get();
   else
@@ -855,7 +919,7 @@ ShaderCache::GetGXPipelineConfig(const GXUberPipelineUid& config_in)
   const AbstractShader* gs = nullptr;
   if (NeedsGeometryShader(config.gs_uid))
   {
-    auto gs_iter = m_gs_cache.shader_map.find(config.gs_uid);
+    auto gs_iter = FindShader<ShaderStage::Geometry>(m_gs_cache, config.gs_uid);
     if (gs_iter != m_gs_cache.shader_map.end() && !gs_iter->second.pending)
       gs = gs_iter->second.shader.get();
     else
@@ -870,17 +934,18 @@ ShaderCache::GetGXPipelineConfig(const GXUberPipelineUid& config_in)
 }
 
 const AbstractPipeline* ShaderCache::InsertGXPipeline(const GXPipelineUid& config,
-                                                      std::unique_ptr<AbstractPipeline> pipeline)
+                                                      std::unique_ptr<AbstractPipeline> pipeline,
+                                                      bool from_disk_cache)
 {
   auto& entry = m_gx_pipeline_cache[config];
-  entry.second = false;
-  if (!entry.first && pipeline)
+  entry.pending = false;
+  if (!entry.pipeline && pipeline)
   {
-    entry.first = std::move(pipeline);
+    entry.pipeline = std::move(pipeline);
 
-    if (g_ActiveConfig.bShaderCache)
+    if (g_ActiveConfig.bShaderCache && !from_disk_cache)
     {
-      auto cache_data = entry.first->GetCacheData();
+      auto cache_data = entry.pipeline->GetCacheData();
       if (!cache_data.empty())
       {
         SerializedGXPipelineUid disk_uid;
@@ -891,22 +956,22 @@ const AbstractPipeline* ShaderCache::InsertGXPipeline(const GXPipelineUid& confi
     }
   }
 
-  return entry.first.get();
+  return entry.pipeline.get();
 }
 
 const AbstractPipeline*
 ShaderCache::InsertGXUberPipeline(const GXUberPipelineUid& config,
-                                  std::unique_ptr<AbstractPipeline> pipeline)
+                                  std::unique_ptr<AbstractPipeline> pipeline, bool from_disk_cache)
 {
   auto& entry = m_gx_uber_pipeline_cache[config];
-  entry.second = false;
-  if (!entry.first && pipeline)
+  entry.pending = false;
+  if (!entry.pipeline && pipeline)
   {
-    entry.first = std::move(pipeline);
+    entry.pipeline = std::move(pipeline);
 
-    if (g_ActiveConfig.bShaderCache)
+    if (g_ActiveConfig.bShaderCache && !from_disk_cache)
     {
-      auto cache_data = entry.first->GetCacheData();
+      auto cache_data = entry.pipeline->GetCacheData();
       if (!cache_data.empty())
       {
         SerializedGXUberPipelineUid disk_uid;
@@ -917,7 +982,7 @@ ShaderCache::InsertGXUberPipeline(const GXUberPipelineUid& config,
     }
   }
 
-  return entry.first.get();
+  return entry.pipeline.get();
 }
 
 void ShaderCache::LoadPipelineUIDCache()
@@ -926,6 +991,9 @@ void ShaderCache::LoadPipelineUIDCache()
   constexpr size_t CACHE_HEADER_SIZE = sizeof(u32) + sizeof(u32);
   std::string filename =
       File::GetUserPath(D_CACHE_IDX) + SConfig::GetInstance().GetGameID() + ".uidcache";
+  m_gx_pipeline_usage_filename =
+      File::GetUserPath(D_CACHE_IDX) + SConfig::GetInstance().GetGameID() + ".uidusage";
+  m_gx_pipeline_uid_count = 0;
   if (m_gx_pipeline_uid_cache_file.Open(filename, "rb+"))
   {
     // If an existing case exists, validate the version before reading entries.
@@ -965,6 +1033,9 @@ void ShaderCache::LoadPipelineUIDCache()
       // We open the file for reading and writing, so we must seek to the end before writing.
       if (uid_file_valid)
         uid_file_valid = m_gx_pipeline_uid_cache_file.Seek(expected_size, File::SeekOrigin::Begin);
+
+      // Done before the file is rewritten below, as the usage history is stored by UID index.
+      LoadPipelineUsage();
     }
 
     // If the file is invalid, close it. We re-open and truncate it below.
@@ -975,6 +1046,7 @@ void ShaderCache::LoadPipelineUIDCache()
   // If the file is not open, it means it was either corrupted or didn't exist.
   if (!m_gx_pipeline_uid_cache_file.IsOpen())
   {
+    m_gx_pipeline_uid_count = 0;
     if (m_gx_pipeline_uid_cache_file.Open(filename, "wb"))
     {
       // Write the version identifier.
@@ -995,12 +1067,67 @@ void ShaderCache::LoadPipelineUIDCache()
 
 void ShaderCache::ClosePipelineUIDCache()
 {
-  // This is left as a method in case we need to append extra data to the file in the future.
+  // The usage history counts sessions, so it is only written when the file is closed for the
+  // first time, and not again after a reload.
+  if (m_gx_pipeline_uid_cache_file.IsOpen())
+    SavePipelineUsage();
   m_gx_pipeline_uid_cache_file.Close();
 }
 
+// The usage history is kept in a separate file, so that the UID cache stays compatible with other
+// versions and can still be shared between users.
+static constexpr u32 PIPELINE_USAGE_FILE_MAGIC = 0x45535550;  // PUSE
+// Bumped whenever the meaning of PipelineUsage changes.
+static constexpr u32 PIPELINE_USAGE_FORMAT_VERSION = 2;  // Last changed: frames to milliseconds
+
+void ShaderCache::LoadPipelineUsage()
+{
+  File::IOFile file(m_gx_pipeline_usage_filename, "rb");
+  u32 magic, version, format_version, count;
+  if (!file.ReadArray(&magic, 1) || !file.ReadArray(&version, 1) ||
+      !file.ReadArray(&format_version, 1) || !file.ReadArray(&count, 1) ||
+      magic != PIPELINE_USAGE_FILE_MAGIC || version != GX_PIPELINE_UID_VERSION ||
+      format_version != PIPELINE_USAGE_FORMAT_VERSION || count > m_gx_pipeline_uid_count ||
+      file.GetSize() != sizeof(u32) * 4 + u64{count} * sizeof(PipelineUsage))
+  {
+    return;
+  }
+
+  std::vector<PipelineUsage> usage(count);
+  if (!file.ReadArray(usage.data(), usage.size()))
+    return;
+
+  for (auto& it : m_gx_pipeline_cache)
+  {
+    if (it.second.uid_cache_index < count)
+      it.second.usage = usage[it.second.uid_cache_index];
+  }
+}
+
+void ShaderCache::SavePipelineUsage()
+{
+  std::vector<PipelineUsage> usage(m_gx_pipeline_uid_count);
+  for (const auto& it : m_gx_pipeline_cache)
+  {
+    if (it.second.uid_cache_index < usage.size())
+      usage[it.second.uid_cache_index] = it.second.usage;
+  }
+
+  File::IOFile file(m_gx_pipeline_usage_filename, "wb");
+  const u32 count = static_cast<u32>(usage.size());
+  if (!file.WriteArray(&PIPELINE_USAGE_FILE_MAGIC, 1) ||
+      !file.WriteArray(&GX_PIPELINE_UID_VERSION, 1) ||
+      !file.WriteArray(&PIPELINE_USAGE_FORMAT_VERSION, 1) || !file.WriteArray(&count, 1) ||
+      !file.WriteArray(usage.data(), usage.size()))
+  {
+    WARN_LOG_FMT(VIDEO, "Failed to write pipeline usage to {}", m_gx_pipeline_usage_filename);
+  }
+}
+
 void ShaderCache::AddSerializedGXPipelineUID(const SerializedGXPipelineUid& uid)
 {
+  const u32 uid_cache_index = m_gx_pipeline_uid_count++;
+
   GXPipelineUid real_uid;
   UnserializePipelineUid(uid, real_uid);
 
@@ -1010,7 +1137,8 @@ void ShaderCache::AddSerializedGXPipelineUID(const SerializedGXPipelineUid& uid)
 
   // Flag it as empty with a null pipeline object, for later compilation.
   auto& entry = m_gx_pipeline_cache[real_uid];
-  entry.second = false;
+  entry.pending = false;
+  entry.uid_cache_index = uid_cache_index;
 }
 
 void ShaderCache::AppendGXPipelineUID(const GXPipelineUid& config)
@@ -1024,7 +1152,10 @@ void ShaderCache::AppendGXPipelineUID(const GXPipelineUid& config)
   {
     WARN_LOG_FMT(VIDEO, "Writing pipeline UID to cache failed, closing file.");
     m_gx_pipeline_uid_cache_file.Close();
+    return;
   }
+
+  m_gx_pipeline_cache[config].uid_cache_index = m_gx_pipeline_uid_count++;
 }
 
 void ShaderCache::QueueVertexShaderCompile(const VertexShaderUid& uid, u32 priority)
@@ -1154,7 +1285,11 @@ void ShaderCache::QueuePipelineCompile(const GXPipelineUid& uid, u32 priority)
       // Check if all the stages required for this pipeline have been compiled.
       // If not, this work item becomes a no-op, and re-queues the pipeline for the next frame.
       if (SetStagesReady())
+      {
         config = shader_cache->GetGXPipelineConfig(uid);
+        if (config)
+          cache_data = shader_cache->LookupPipelineCacheData(uid);
+      }
     }
 
     bool SetStagesReady()
@@ -1163,7 +1298,7 @@ void ShaderCache::QueuePipelineCompile(const GXPipelineUid& uid, u32 priority)
 
       GXPipelineUid actual_uid = ApplyDriverBugs(uid);
 
-      auto vs_it = shader_cache->m_vs_cache.shader_map.find(actual_uid.vs_uid);
+      auto vs_it = FindShader<ShaderStage::Vertex>(shader_cache->m_vs_cache, actual_uid.vs_uid);
       stages_ready &= vs_it != shader_cache->m_vs_cache.shader_map.end() && !vs_it->second.pending;
       if (vs_it == shader_cache->m_vs_cache.shader_map.end())
         shader_cache->QueueVertexShaderCompile(actual_uid.vs_uid, priority);
@@ -1171,7 +1306,7 @@ void ShaderCache::QueuePipelineCompile(const GXPipelineUid& uid, u32 priority)
       PixelShaderUid ps_uid = actual_uid.ps_uid;
       ClearUnusedPixelShaderUidBits(shader_cache->m_api_type, shader_cache->m_host_config, &ps_uid);
 
-      auto ps_it = shader_cache->m_ps_cache.shader_map.find(ps_uid);
+      auto ps_it = FindShader<ShaderStage::Pixel>(shader_cache->m_ps_cache, ps_uid);
       stages_ready &= ps_it != shader_cache->m_ps_cache.shader_map.end() && !ps_it->second.pending;
       if (ps_it == shader_cache->m_ps_cache.shader_map.end())
         shader_cache->QueuePixelShaderCompile(ps_uid, priority);
@@ -1182,7 +1317,7 @@ void ShaderCache::QueuePipelineCompile(const GXPipelineUid& uid, u32 priority)
     bool Compile() override
     {
       if (config)
-        pipeline = g_gfx->CreatePipeline(*config);
+        pipeline = CreatePipeline(*config, &cache_data);
       return true;
     }
 
@@ -1190,7 +1325,7 @@ void ShaderCache::QueuePipelineCompile(const GXPipelineUid& uid, u32 priority)
     {
       if (stages_ready)
       {
-        shader_cache->InsertGXPipeline(uid, std::move(pipeline));
+        shader_cache->InsertGXPipeline(uid, std::move(pipeline), !cache_data.empty());
       }
       else
       {
@@ -1207,12 +1342,13 @@ void ShaderCache::QueuePipelineCompile(const GXPipelineUid& uid, u32 priority)
     GXPipelineUid uid;
     u32 priority;
     std::optional<AbstractPipelineConfig> config;
+    std::vector<u8> cache_data;
     bool stages_ready;
   };
 
   auto wi = m_async_shader_compiler->CreateWorkItem<PipelineWorkItem>(this, uid, priority);
   m_async_shader_compiler->QueueWorkItem(std::move(wi), priority);
-  m_gx_pipeline_cache[uid].second = true;
+  m_gx_pipeline_cache[uid].pending = true;
 }
 
 void ShaderCache::QueueUberPipelineCompile(const GXUberPipelineUid& uid, u32 priority)
@@ -1226,7 +1362,11 @@ void ShaderCache::QueueUberPipelineCompile(const GXUberPipelineUid& uid, u32 pri
       // Check if all the stages required for this UberPipeline have been compiled.
       // If not, this work item becomes a no-op, and re-queues the UberPipeline for the next frame.
       if (SetStagesReady())
+      {
         config = shader_cache->GetGXPipelineConfig(uid);
+        if (config)
+          cache_data = shader_cache->LookupPipelineCacheData(uid);
+      }
     }
 
     bool SetStagesReady()
@@ -1235,7 +1375,8 @@ void ShaderCache::QueueUberPipelineCompile(const GXUberPipelineUid& uid, u32 pri
 
       GXUberPipelineUid actual_uid = ApplyDriverBugs(uid);
 
-      auto vs_it = shader_cache->m_uber_vs_cache.shader_map.find(actual_uid.vs_uid);
+      auto vs_it =
+          FindShader<ShaderStage::Vertex>(shader_cache->m_uber_vs_cache, actual_uid.vs_uid);
       stages_ready &=
           vs_it != shader_cache->m_uber_vs_cache.shader_map.end() && !vs_it->second.pending;
       if (vs_it == shader_cache->m_uber_vs_cache.shader_map.end())
@@ -1245,7 +1386,7 @@ void ShaderCache::QueueUberPipelineCompile(const GXUberPipelineUid& uid, u32 pri
       UberShader::ClearUnusedPixelShaderUidBits(shader_cache->m_api_type,
                                                 shader_cache->m_host_config, &ps_uid);
 
-      auto ps_it = shader_cache->m_uber_ps_cache.shader_map.find(ps_uid);
+      auto ps_it = FindShader<ShaderStage::Pixel>(shader_cache->m_uber_ps_cache, ps_uid);
       stages_ready &=
           ps_it != shader_cache->m_uber_ps_cache.shader_map.end() && !ps_it->second.pending;
       if (ps_it == shader_cache->m_uber_ps_cache.shader_map.end())
@@ -1257,7 +1398,7 @@ void ShaderCache::QueueUberPipelineCompile(const GXUberPipelineUid& uid, u32 pri
     bool Compile() override
     {
       if (config)
-        UberPipeline = g_gfx->CreatePipeline(*config);
+        UberPipeline = CreatePipeline(*config, &cache_data);
       return true;
     }
 
@@ -1265,7 +1406,7 @@ void ShaderCache::QueueUberPipelineCompile(const GXUberPipelineUid& uid, u32 pri
     {
       if (stages_ready)
       {
-        shader_cache->InsertGXUberPipeline(uid, std::move(UberPipeline));
+        shader_cache->InsertGXUberPipeline(uid, std::move(UberPipeline), !cache_data.empty());
       }
       else
       {
@@ -1282,12 +1423,13 @@ void ShaderCache::QueueUberPipelineCompile(const GXUberPipelineUid& uid, u32 pri
     GXUberPipelineUid uid;
     u32 priority;
     std::optional<AbstractPipelineConfig> config;
+    std::vector<u8> cache_data;
     bool stages_ready;
   };
 
   auto wi = m_async_shader_compiler->CreateWorkItem<UberPipelineWorkItem>(this, uid, priority);
   m_async_shader_compiler->QueueWorkItem(std::move(wi), priority);
-  m_gx_uber_pipeline_cache[uid].second = true;
+  m_gx_uber_pipeline_cache[uid].pending = true;
 }
 
 void ShaderCache::QueueUberShaderPipelines()
@@ -1325,7 +1467,7 @@ void ShaderCache::QueueUberShaderPipelines()
           return;
 
         auto& entry = m_gx_uber_pipeline_cache[config];
-        entry.second = false;
+        entry.pending = false;
       };
 
   // Populate the pipeline configs with empty entries, these will be compiled afterwards.
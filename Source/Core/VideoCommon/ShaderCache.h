@@ -6,16 +6,18 @@
 #include <array>
 #include <cstddef>
 #include <cstring>
+#include <limits>
 #include <map>
 #include <memory>
 #include <optional>
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/IOFile.h"
-#include "Common/LinearDiskCache.h"
+#include "Common/IndexedDiskCache.h"
 
 #include "VideoCommon/AbstractPipeline.h"
 #include "VideoCommon/AbstractShader.h"
@@ -117,12 +119,39 @@ public:
 private:
   static constexpr size_t NUM_PALETTE_CONVERSION_SHADERS = 3;
 
-  void WaitForAsyncCompiler();
+  // Usage history of a specialized pipeline, kept next to the UID cache.
+  struct PipelineUsage
+  {
+    // Emulated time in milliseconds at which the pipeline was first needed, in the last session
+    // that needed it. Stored as time rather than frames, as games differ in frame rate.
+    u32 first_use_ms = 0;
+    // Number of sessions in which the pipeline was needed.
+    u32 num_sessions = 0;
+  };
+
+  static constexpr u32 INVALID_UID_CACHE_INDEX = 0xFFFFFFFF;
+
+  struct PipelineCacheEntry
+  {
+    std::unique_ptr<AbstractPipeline> pipeline;
+    // Set while the pipeline is compiling in the background.
+    bool pending = false;
+
+    // Only tracked for specialized pipelines.
+    bool used = false;
+    u32 uid_cache_index = INVALID_UID_CACHE_INDEX;
+    PipelineUsage usage;
+  };
+
+  void WaitForAsyncCompiler(u32 max_priority = std::numeric_limits<u32>::max());
   void LoadCaches();
   void ClearCaches();
   void LoadPipelineUIDCache();
   void ClosePipelineUIDCache();
-  void CompileMissingPipelines();
+  void LoadPipelineUsage();
+  void SavePipelineUsage();
+  void RecordGXPipelineUse(PipelineCacheEntry& entry);
+  u32 CompileMissingPipelines();
   void QueueUberShaderPipelines();
   bool CompileSharedPipelines();
 
@@ -156,9 +185,15 @@ private:
   std::optional<AbstractPipelineConfig> GetGXPipelineConfig(const GXPipelineUid& uid);
   std::optional<AbstractPipelineConfig> GetGXPipelineConfig(const GXUberPipelineUid& uid);
   const AbstractPipeline* InsertGXPipeline(const GXPipelineUid& config,
-                                           std::unique_ptr<AbstractPipeline> pipeline);
+                                           std::unique_ptr<AbstractPipeline> pipeline,
+                                           bool from_disk_cache);
   const AbstractPipeline* InsertGXUberPipeline(const GXUberPipelineUid& config,
-                                               std::unique_ptr<AbstractPipeline> pipeline);
+                                               std::unique_ptr<AbstractPipeline> pipeline,
+                                               bool from_disk_cache);
+  std::vector<u8> LookupPipelineCacheData(const GXPipelineUid& uid);
+  std::vector<u8> LookupPipelineCacheData(const GXUberPipelineUid& uid);
+  static std::unique_ptr<AbstractPipeline> CreatePipeline(const AbstractPipelineConfig& config,
+                                                          std::vector<u8>* cache_data);
   void AddSerializedGXPipelineUID(const SerializedGXPipelineUid& uid);
   void AppendGXPipelineUID(const GXPipelineUid& config);
 
@@ -171,13 +206,13 @@ private:
   void QueueUberPipelineCompile(const GXUberPipelineUid& uid, u32 priority);
 
   // Populating various caches.
-  template <ShaderStage stage, typename K, typename T>
+  template <typename T>
   void LoadShaderCache(T& cache, APIType api_type, const char* type, bool include_gameid);
   template <typename T>
   void ClearShaderCache(T& cache);
-  template <typename KeyType, typename DiskKeyType, typename T>
-  void LoadPipelineCache(T& cache, Common::LinearDiskCache<DiskKeyType, u8>& disk_cache,
-                         APIType api_type, const char* type, bool include_gameid);
+  template <typename DiskKeyType>
+  void LoadPipelineCache(Common::IndexedDiskCache<DiskKeyType, u8>& disk_cache, APIType api_type,
+                         const char* type, bool include_gameid);
   template <typename T, typename Y>
   void ClearPipelineCache(T& cache, Y& disk_cache);
 
@@ -216,7 +251,7 @@ private:
       bool pending = false;
     };
     std::map<Uid, Shader> shader_map;
-    Common::LinearDiskCache<Uid, u8> disk_cache;
+    Common::IndexedDiskCache<Uid, u8> disk_cache;
   };
   ShaderModuleCache<VertexShaderUid> m_vs_cache;
   ShaderModuleCache<GeometryShaderUid> m_gs_cache;
@@ -224,13 +259,14 @@ private:
   ShaderModuleCache<UberShader::VertexShaderUid> m_uber_vs_cache;
   ShaderModuleCache<UberShader::PixelShaderUid> m_uber_ps_cache;
 
-  // GX Pipeline Caches - .first - pipeline, .second - pending
-  std::map<GXPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>> m_gx_pipeline_cache;
-  std::map<GXUberPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>>
-      m_gx_uber_pipeline_cache;
+  // GX Pipeline Caches
+  std::map<GXPipelineUid, PipelineCacheEntry> m_gx_pipeline_cache;
+  std::map<GXUberPipelineUid, PipelineCacheEntry> m_gx_uber_pipeline_cache;
   File::IOFile m_gx_pipeline_uid_cache_file;
-  Common::LinearDiskCache<SerializedGXPipelineUid, u8> m_gx_pipeline_disk_cache;
-  Common::LinearDiskCache<SerializedGXUberPipelineUid, u8> m_gx_uber_pipeline_disk_cache;
+  std::string m_gx_pipeline_usage_filename;
+  u32 m_gx_pipeline_uid_count = 0;
+  Common::IndexedDiskCache<SerializedGXPipelineUid, u8> m_gx_pipeline_disk_cache;
+  Common::IndexedDiskCache<SerializedGXUberPipelineUid, u8> m_gx_uber_pipeline_disk_cache;
 
   // EFB copy to VRAM/RAM pipelines
   std::map<TextureConversionShaderGen::TCShaderUid, std::unique_ptr<AbstractPipeline>>
@@ -63,7 +63,7 @@ public:
  * Unless performance is not an issue, uid_data should be tightly packed to reduce memory footprint.
  * Shader generators will write to specific uid_data fields; ShaderUid methods will only read raw
  * u32 values from a union.
- * NOTE: Because LinearDiskCache reads and writes the storage associated with a ShaderUid instance,
+ * NOTE: Because the disk caches read and write the storage associated with a ShaderUid instance,
  * ShaderUid must be trivially copyable.
  */
 template <class uid_data>
@@ -90,10 +90,18 @@ void Statistics::Display() const
   draw_statistic("Textures created", "%d", num_textures_created);
   draw_statistic("Textures uploaded", "%d", num_textures_uploaded);
   draw_statistic("Textures alive", "%d", num_textures_alive);
+  draw_statistic("Texture cache hits", "%d/%d",
+                 this_frame.num_texture_lookups - this_frame.num_texture_cache_misses,
+                 this_frame.num_texture_lookups);
+  draw_statistic("Texture overlap searches", "%d", this_frame.num_texture_overlap_searches);
+  draw_statistic("Texture overlap candidates", "%d", this_frame.num_texture_overlap_candidates);
   draw_statistic("pshaders created", "%d", num_pixel_shaders_created);
   draw_statistic("pshaders alive", "%d", num_pixel_shaders_alive);
   draw_statistic("vshaders created", "%d", num_vertex_shaders_created);
   draw_statistic("vshaders alive", "%d", num_vertex_shaders_alive);
+  draw_statistic("Pipeline cache hits", "%d/%d", num_pipeline_cache_hits,
+                 num_pipeline_cache_hits + num_pipeline_cache_misses);
+  draw_statistic("Pending compiles", "%d", num_pending_shader_compiles);
   draw_statistic("shaders changes", "%d", this_frame.num_shader_changes);
   draw_statistic("dlists called", "%d", this_frame.num_dlists_called);
   draw_statistic("Primitive joins", "%d", this_frame.num_primitive_joins);
@@ -15,6 +15,12 @@ struct Statistics
   int num_vertex_shaders_created = 0;
   int num_vertex_shaders_alive = 0;
 
+  // Specialized pipelines which were, or weren't, already compiled when they were first needed.
+  int num_pipeline_cache_hits = 0;
+  int num_pipeline_cache_misses = 0;
+  // Shaders and pipelines waiting for the background compiler threads.
+  int num_pending_shader_compiles = 0;
+
   int num_textures_created = 0;
   int num_textures_uploaded = 0;
   int num_textures_alive = 0;
@@ -58,6 +64,13 @@ struct Statistics
 
     int num_dlists_called = 0;
 
+    // Texture loads, and how many of those had to create a new texture cache entry
+    int num_texture_lookups = 0;
+    int num_texture_cache_misses = 0;
+    // Address range searches for overlapping textures, and the entries they had to check
+    int num_texture_overlap_searches = 0;
+    int num_texture_overlap_candidates = 0;
+
     int bytes_vertex_streamed = 0;
     int bytes_index_streamed = 0;
     int bytes_uniform_streamed = 0;
@@ -5,12 +5,17 @@
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <functional>
+#include <mutex>
 #include <span>
+#include <thread>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/MsgHandler.h"
 #include "Common/SpanUtils.h"
 #include "Common/Swap.h"
+#include "Common/WorkQueueThread.h"
 
 #include "VideoCommon/LookUpTables.h"
 #include "VideoCommon/TextureDecoder.h"
@@ -20,6 +25,13 @@
 static bool TexFmt_Overlay_Enable = false;
 static bool TexFmt_Overlay_Center = false;
 
+// Textures with at least this many texels are decoded on several threads. Below that, starting the
+// threads costs more than the decoding itself.
+constexpr int PARALLEL_DECODE_MIN_TEXELS = 512 * 512;
+// Including the calling thread. Decoding is mostly bound by memory bandwidth, so more threads than
+// this don't make it any faster.
+constexpr int MAX_PARALLEL_DECODE_THREADS = 4;
+
 // TRAM
 // STATE_TO_SAVE
 alignas(16) std::array<u8, TMEM_SIZE> s_tex_mem;
@@ -298,10 +310,86 @@ static void TexDecoder_DrawOverlay(u8* dst, int width, int height, TextureFormat
   }
 }
 
+namespace
+{
+// Threads that help decoding large textures. They are started when the first such texture is
+// decoded and kept until shutdown, rather than starting new threads for every texture.
+class DecodeWorkers
+{
+public:
+  DecodeWorkers()
+      : m_workers(std::clamp(static_cast<int>(std::thread::hardware_concurrency()), 1,
+                             MAX_PARALLEL_DECODE_THREADS) -
+                  1)
+  {
+    for (auto& worker : m_workers)
+      worker.Reset("Texture Decoder", [](std::function<void()> strip) { strip(); });
+  }
+
+  std::vector<Common::WorkQueueThread<std::function<void()>>>& GetWorkers() { return m_workers; }
+  std::mutex& GetLock() { return m_lock; }
+
+private:
+  std::vector<Common::WorkQueueThread<std::function<void()>>> m_workers;
+  // Held while a texture is being decoded by the workers
+  std::mutex m_lock;
+};
+}  // namespace
+
+static void DecodeInParallel(u8* dst, const u8* src, int width, int height,
+                             TextureFormat texformat, const u8* tlut, TLUTFormat tlutfmt)
+{
+  static DecodeWorkers s_decode_workers;
+
+  // Rows of blocks don't depend on each other, so the texture can be split into horizontal strips
+  // of whole blocks which are decoded separately.
+  const int block_height = TexDecoder_GetBlockHeightInTexels(texformat);
+  const int block_rows = height / block_height;
+  const auto decode_strip = [=](int start_row, int end_row) {
+    const int start_y = start_row * block_height;
+    _TexDecoder_DecodeImpl(reinterpret_cast<u32*>(dst) + start_y * width,
+                           src + TexDecoder_GetTextureSizeInBytes(width, start_y, texformat), width,
+                           (end_row - start_row) * block_height, texformat, tlut, tlutfmt);
+  };
+
+  // If another thread is using the workers, decode this texture on its own thread instead of
+  // waiting for them.
+  std::unique_lock lock(s_decode_workers.GetLock(), std::try_to_lock);
+  if (!lock.owns_lock())
+  {
+    decode_strip(0, block_rows);
+    return;
+  }
+
+  auto& workers = s_decode_workers.GetWorkers();
+  const int threads = std::min(block_rows, static_cast<int>(workers.size()) + 1);
+  for (int i = 1; i < threads; ++i)
+  {
+    const int start_row = i * block_rows / threads;
+    const int end_row = (i + 1) * block_rows / threads;
+    workers[i - 1].Push([=] { decode_strip(start_row, end_row); });
+  }
+
+  // The first strip is decoded on the calling thread
+  decode_strip(0, block_rows / threads);
+
+  for (int i = 1; i < threads; ++i)
+    workers[i - 1].WaitForCompletion();
+}
+
 void TexDecoder_Decode(u8* dst, const u8* src, int width, int height, TextureFormat texformat,
                        const u8* tlut, TLUTFormat tlutfmt)
 {
-  _TexDecoder_DecodeImpl((u32*)dst, src, width, height, texformat, tlut, tlutfmt);
+  if (width * height >= PARALLEL_DECODE_MIN_TEXELS &&
+      height % TexDecoder_GetBlockHeightInTexels(texformat) == 0 &&
+      std::thread::hardware_concurrency() > 1)
+  {
+    DecodeInParallel(dst, src, width, height, texformat, tlut, tlutfmt);
+  }
+  else
+  {
+    _TexDecoder_DecodeImpl((u32*)dst, src, width, height, texformat, tlut, tlutfmt);
+  }
 
   if (TexFmt_Overlay_Enable)
     TexDecoder_DrawOverlay(dst, width, height, texformat);
@@ -275,6 +275,9 @@ struct VideoConfig final
 
   // Shader compilation settings.
   bool bWaitForShadersBeforeStarting = false;
+  // Only wait for the pipelines that previous sessions needed in this many seconds after booting,
+  // and compile the rest in the background. 0 waits for all of them.
+  int iWaitForShadersSeconds = 0;
   ShaderCompilationMode iShaderCompilationMode{};
 
   // Number of shader compiler threads.
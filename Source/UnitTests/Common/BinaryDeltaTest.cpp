@@ -0,0 +1,84 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/BinaryDelta.h"
+#include "Common/CommonTypes.h"
+
+static std::vector<u8> MakeRandomBuffer(size_t size, u32 seed)
+{
+  std::mt19937 rng(seed);
+  std::vector<u8> buffer(size);
+  for (u8& byte : buffer)
+    byte = static_cast<u8>(rng());
+  return buffer;
+}
+
+TEST(BinaryDelta, Identical)
+{
+  const std::vector<u8> base = MakeRandomBuffer(1000000, 1);
+  const std::vector<u8> delta = Common::CreateBinaryDelta(base, base);
+  EXPECT_LT(delta.size(), 64u);
+
+  const auto result = Common::ApplyBinaryDelta(base, delta);
+  ASSERT_TRUE(result.has_value());
+  EXPECT_EQ(base, *result);
+}
+
+TEST(BinaryDelta, ChangedPages)
+{
+  const std::vector<u8> base = MakeRandomBuffer(1000000, 2);
+  std::vector<u8> target = base;
+  target[5000] ^= 0xFF;
+  target[500000] ^= 0xFF;
+  target.back() ^= 0xFF;
+
+  const std::vector<u8> delta = Common::CreateBinaryDelta(base, target);
+  EXPECT_LT(delta.size(), 4u * 4096u);
+
+  const auto result = Common::ApplyBinaryDelta(base, delta);
+  ASSERT_TRUE(result.has_value());
+  EXPECT_EQ(target, *result);
+}
+
+TEST(BinaryDelta, ShiftedData)
+{
+  const std::vector<u8> base = MakeRandomBuffer(1000000, 3);
+  std::vector<u8> target = base;
+  target.insert(target.begin() + 100, {1, 2, 3, 4, 5, 6, 7});
+  target.erase(target.begin() + 600000, target.begin() + 600003);
+
+  const std::vector<u8> delta = Common::CreateBinaryDelta(base, target);
+  EXPECT_LT(delta.size(), 4u * 4096u);
+
+  const auto result = Common::ApplyBinaryDelta(base, delta);
+  ASSERT_TRUE(result.has_value());
+  EXPECT_EQ(target, *result);
+}
+
+TEST(BinaryDelta, Unrelated)
+{
+  const std::vector<u8> base = MakeRandomBuffer(100000, 4);
+  const std::vector<u8> target = MakeRandomBuffer(54321, 5);
+
+  const auto result =
+      Common::ApplyBinaryDelta(base, Common::CreateBinaryDelta(base, target));
+  ASSERT_TRUE(result.has_value());
+  EXPECT_EQ(target, *result);
+}
+
+TEST(BinaryDelta, WrongBase)
+{
+  const std::vector<u8> base = MakeRandomBuffer(100000, 6);
+  const std::vector<u8> other = MakeRandomBuffer(90000, 7);
+  const std::vector<u8> delta = Common::CreateBinaryDelta(base, base);
+
+  EXPECT_FALSE(Common::ApplyBinaryDelta(other, delta).has_value());
+  EXPECT_FALSE(
+      Common::ApplyBinaryDelta(base, std::span<const u8>(delta).first(delta.size() - 1))
+          .has_value());
+}
@@ -0,0 +1,201 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/IndexedDiskCache.h"
+
+class IndexedDiskCacheTest : public testing::Test
+{
+protected:
+  IndexedDiskCacheTest()
+      : m_parent_directory(File::CreateTempDir()), m_file_path(m_parent_directory + "/cache.bin")
+  {
+  }
+
+  ~IndexedDiskCacheTest() override
+  {
+    if (!m_parent_directory.empty())
+      File::DeleteDirRecursively(m_parent_directory);
+  }
+
+  void SetUp() override
+  {
+    if (m_parent_directory.empty())
+      FAIL();
+  }
+
+  static std::vector<u8> MakeValue(u32 key) { return std::vector<u8>(key % 100 + 1, u8(key)); }
+
+  void FillCache(Common::IndexedDiskCache<u32, u8>& cache, u32 count)
+  {
+    for (u32 key = 0; key < count; ++key)
+    {
+      const std::vector<u8> value = MakeValue(key);
+      cache.Append(key, value.data(), static_cast<u32>(value.size()));
+    }
+  }
+
+  const std::string m_parent_directory;
+  const std::string m_file_path;
+};
+
+TEST_F(IndexedDiskCacheTest, LookupAfterReopen)
+{
+  {
+    Common::IndexedDiskCache<u32, u8> cache;
+    EXPECT_EQ(cache.Open(m_file_path), 0u);
+    FillCache(cache, 1000);
+    EXPECT_EQ(cache.Lookup(123), MakeValue(123));
+  }
+
+  Common::IndexedDiskCache<u32, u8> cache;
+  EXPECT_EQ(cache.Open(m_file_path), 1000u);
+  for (u32 key = 0; key < 1000; ++key)
+    EXPECT_EQ(cache.Lookup(key), MakeValue(key));
+  EXPECT_FALSE(cache.Lookup(1000).has_value());
+
+  // Entries appended after opening are read from the file rather than the mapping
+  const std::vector<u8> value(10, 0xAB);
+  cache.Append(1000, value.data(), static_cast<u32>(value.size()));
+  EXPECT_EQ(cache.Lookup(1000), value);
+}
+
+TEST_F(IndexedDiskCacheTest, ReplaceAndErase)
+{
+  const std::vector<u8> value(10, 0xAB);
+  {
+    Common::IndexedDiskCache<u32, u8> cache;
+    cache.Open(m_file_path);
+    FillCache(cache, 10);
+    cache.Append(5, value.data(), static_cast<u32>(value.size()));
+    cache.Erase(6);
+    EXPECT_EQ(cache.GetEntryCount(), 9u);
+  }
+
+  Common::IndexedDiskCache<u32, u8> cache;
+  EXPECT_EQ(cache.Open(m_file_path), 9u);
+  EXPECT_EQ(cache.Lookup(5), value);
+  EXPECT_FALSE(cache.Contains(6));
+  EXPECT_EQ(cache.Lookup(7), MakeValue(7));
+}
+
+TEST_F(IndexedDiskCacheTest, Compact)
+{
+  Common::IndexedDiskCache<u32, u8> cache;
+  cache.Open(m_file_path);
+  FillCache(cache, 1000);
+  FillCache(cache, 1000);
+  cache.Sync();
+  const u64 size_before = File::GetSize(m_file_path);
+
+  EXPECT_TRUE(cache.Compact());
+  EXPECT_LT(File::GetSize(m_file_path), size_before * 2 / 3);
+  EXPECT_EQ(cache.GetEntryCount(), 1000u);
+  for (u32 key = 0; key < 1000; ++key)
+    EXPECT_EQ(cache.Lookup(key), MakeValue(key));
+}
+
+TEST_F(IndexedDiskCacheTest, RebuildsIndexWithoutClose)
+{
+  {
+    Common::IndexedDiskCache<u32, u8> cache;
+    cache.Open(m_file_path);
+    FillCache(cache, 100);
+  }
+
+  // Simulate a crash by copying the file while the index isn't written
+  const std::string copy_path = m_parent_directory + "/copy.bin";
+  {
+    Common::IndexedDiskCache<u32, u8> cache;
+    cache.Open(m_file_path);
+    const std::vector<u8> value(10, 0xAB);
+    cache.Append(100, value.data(), static_cast<u32>(value.size()));
+    cache.Sync();
+    ASSERT_TRUE(File::Copy(m_file_path, copy_path));
+  }
+
+  Common::IndexedDiskCache<u32, u8> cache;
+  EXPECT_EQ(cache.Open(copy_path), 101u);
+  EXPECT_EQ(cache.Lookup(42), MakeValue(42));
+  EXPECT_EQ(cache.Lookup(100), std::vector<u8>(10, 0xAB));
+}
+
+TEST_F(IndexedDiskCacheTest, CorruptedEntry)
+{
+  {
+    Common::IndexedDiskCache<u32, u8> cache;
+    cache.Open(m_file_path);
+    FillCache(cache, 100);
+  }
+
+  // Overwrite the value of the first entry, which follows the 64-byte file header, the 12-byte
+  // entry header and the key
+  {
+    File::IOFile file(m_file_path, "r+b");
+    constexpr u64 first_value_offset = 64 + 12 + sizeof(u32);
+    const u8 garbage = 0xFF;
+    file.Seek(first_value_offset, File::SeekOrigin::Begin);
+    file.WriteArray(&garbage, 1);
+  }
+
+  Common::IndexedDiskCache<u32, u8> cache;
+  EXPECT_EQ(cache.Open(m_file_path), 100u);
+  EXPECT_FALSE(cache.Lookup(0).has_value());
+  EXPECT_FALSE(cache.Contains(0));
+  EXPECT_EQ(cache.Lookup(1), MakeValue(1));
+}
+
+TEST_F(IndexedDiskCacheTest, RecreateKeepsOtherMappingsValid)
+{
+  {
+    Common::IndexedDiskCache<u32, u8> cache;
+    cache.Open(m_file_path);
+    FillCache(cache, 100);
+  }
+
+  Common::IndexedDiskCache<u32, u8> cache;
+  EXPECT_EQ(cache.Open(m_file_path), 100u);
+
+  // Break the header so that the next instance recreates the file while the first has it mapped
+  {
+    File::IOFile file(m_file_path, "r+b");
+    const u32 garbage = 0;
+    file.WriteArray(&garbage, 1);
+  }
+
+  Common::IndexedDiskCache<u32, u8> other_cache;
+  EXPECT_EQ(other_cache.Open(m_file_path), 0u);
+  other_cache.Close();
+
+  for (u32 key = 0; key < 100; ++key)
+    EXPECT_EQ(cache.Lookup(key), MakeValue(key));
+}
+
+TEST_F(IndexedDiskCacheTest, TruncatedFile)
+{
+  {
+    Common::IndexedDiskCache<u32, u8> cache;
+    cache.Open(m_file_path);
+    FillCache(cache, 100);
+  }
+
+  // The index now points past the end of the file, so the entries that are left are scanned
+  {
+    File::IOFile file(m_file_path, "r+b");
+    ASSERT_TRUE(file.Resize(file.GetSize() / 2));
+  }
+
+  Common::IndexedDiskCache<u32, u8> cache;
+  const u32 entry_count = cache.Open(m_file_path);
+  EXPECT_GT(entry_count, 0u);
+  EXPECT_LT(entry_count, 100u);
+  for (u32 key = 0; key < entry_count; ++key)
+    EXPECT_EQ(cache.Lookup(key), MakeValue(key));
+}
@@ -0,0 +1,83 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <string>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/IOFile.h"
+#include "Common/MappedFile.h"
+
+class MappedFileTest : public testing::Test
+{
+protected:
+  MappedFileTest()
+      : m_parent_directory(File::CreateTempDir()), m_file_path(m_parent_directory + "/file.bin")
+  {
+  }
+
+  ~MappedFileTest() override
+  {
+    if (!m_parent_directory.empty())
+      File::DeleteDirRecursively(m_parent_directory);
+  }
+
+  void SetUp() override
+  {
+    if (m_parent_directory.empty())
+      FAIL();
+  }
+
+  const std::string m_parent_directory;
+  const std::string m_file_path;
+};
+
+TEST_F(MappedFileTest, MapsFileContents)
+{
+  constexpr std::array<u8, 5> data{1, 2, 3, 4, 5};
+  {
+    File::IOFile file(m_file_path, "wb");
+    ASSERT_TRUE(file.WriteArray(data));
+  }
+
+  File::MappedFile mapping;
+  {
+    File::IOFile file(m_file_path, "rb");
+    ASSERT_TRUE(mapping.Map(file));
+  }
+
+  // The mapping stays valid after the file has been closed.
+  ASSERT_TRUE(mapping.IsMapped());
+  EXPECT_EQ(mapping.GetSize(), data.size());
+  EXPECT_TRUE(std::ranges::equal(mapping.GetSpan(), data));
+
+  File::MappedFile moved = std::move(mapping);
+  EXPECT_FALSE(mapping.IsMapped());
+  EXPECT_TRUE(std::ranges::equal(moved.GetSpan(), data));
+
+  moved.Unmap();
+  EXPECT_FALSE(moved.IsMapped());
+  EXPECT_EQ(moved.GetSize(), 0u);
+}
+
+TEST_F(MappedFileTest, EmptyFileIsNotMapped)
+{
+  ASSERT_TRUE(File::CreateEmptyFile(m_file_path));
+
+  File::IOFile file(m_file_path, "rb");
+  File::MappedFile mapping;
+  EXPECT_FALSE(mapping.Map(file));
+  EXPECT_FALSE(mapping.IsMapped());
+}
+
+TEST_F(MappedFileTest, ClosedFileIsNotMapped)
+{
+  File::IOFile file;
+  File::MappedFile mapping;
+  EXPECT_FALSE(mapping.Map(file));
+}
@@ -0,0 +1,127 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CPUDetect.h"
+#include "Common/CommonTypes.h"
+#include "Core/HW/DSPHLE/UCodes/AXMix.h"
+
+// These are the per-sample loops that AXVoice.h used before they were vectorized.
+static s16 ReferenceClampS16(s64 sample)
+{
+  return std::clamp<s64>(sample, -0x8000, 0x7FFF);
+}
+
+static u16 ReferenceApplyVolumeRamp(s16* samples, u32 count, u16 volume, u16 volume_delta,
+                                    bool signed_volume)
+{
+  s16 cur_volume = static_cast<s16>(volume);
+  for (u32 i = 0; i < count; ++i)
+  {
+    const s32 vol = signed_volume ? (s16)cur_volume : (u16)cur_volume;
+    const s32 sample = ((s32)samples[i] * vol) >> 15;
+    samples[i] = ReferenceClampS16(sample);
+    cur_volume += static_cast<s16>(volume_delta);
+  }
+  return static_cast<u16>(cur_volume);
+}
+
+static u16 ReferenceMixAdd(int* out, const s16* input, u32 count, u16 volume, u16 volume_delta,
+                           s16* dpop)
+{
+  for (u32 i = 0; i < count; ++i)
+  {
+    s64 sample = input[i];
+    sample *= volume;
+    sample >>= 15;
+    s16 sample16 = ReferenceClampS16((s32)sample);
+
+    out[i] += sample16;
+    volume += volume_delta;
+
+    *dpop = sample16;
+  }
+  return volume;
+}
+
+static std::vector<s16> MakeSamples(std::mt19937& rng, u32 count)
+{
+  std::vector<s16> samples(count);
+  for (s16& sample : samples)
+  {
+    // Make sure the extremes show up often
+    switch (rng() % 8)
+    {
+    case 0:
+      sample = -0x8000;
+      break;
+    case 1:
+      sample = 0x7FFF;
+      break;
+    default:
+      sample = static_cast<s16>(rng());
+      break;
+    }
+  }
+  return samples;
+}
+
+static void TestMatchesReference()
+{
+  std::mt19937 rng(1234);
+  for (int iteration = 0; iteration < 2000; ++iteration)
+  {
+    const u32 count = rng() % 100;
+    const u16 volume = static_cast<u16>(rng());
+    const u16 volume_delta = static_cast<u16>(iteration % 4 == 0 ? 0 : rng());
+    const std::vector<s16> input = MakeSamples(rng, count);
+
+    for (bool signed_volume : {false, true})
+    {
+      std::vector<s16> expected = input;
+      std::vector<s16> actual = input;
+      const u16 expected_volume = ReferenceApplyVolumeRamp(expected.data(), count, volume,
+                                                           volume_delta, signed_volume);
+      const u16 actual_volume =
+          DSP::HLE::ApplyVolumeRamp(actual.data(), count, volume, volume_delta, signed_volume);
+      EXPECT_EQ(expected, actual);
+      EXPECT_EQ(expected_volume, actual_volume);
+    }
+
+    std::vector<int> expected_out(count);
+    for (int& value : expected_out)
+      value = static_cast<int>(rng() % 0x100000) - 0x80000;
+    std::vector<int> actual_out = expected_out;
+    s16 expected_dpop = 123;
+    s16 actual_dpop = 123;
+    const u16 expected_volume = ReferenceMixAdd(expected_out.data(), input.data(), count, volume,
+                                                volume_delta, &expected_dpop);
+    const u16 actual_volume = DSP::HLE::MixAddWithRamp(actual_out.data(), input.data(), count,
+                                                       volume, volume_delta, &actual_dpop);
+    EXPECT_EQ(expected_out, actual_out);
+    EXPECT_EQ(expected_volume, actual_volume);
+    EXPECT_EQ(expected_dpop, actual_dpop);
+  }
+}
+
+TEST(AXMix, MatchesReference)
+{
+  TestMatchesReference();
+}
+
+#ifdef _M_X86_64
+TEST(AXMix, MatchesReferenceWithoutAVX2)
+{
+  const CPUInfo original_cpu_info = cpu_info;
+  cpu_info.bAVX2 = false;
+  TestMatchesReference();
+  cpu_info.bSSE4_1 = false;
+  TestMatchesReference();
+  cpu_info = original_cpu_info;
+}
+#endif
@@ -0,0 +1,136 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/Swap.h"
+#include "DiscIO/Blob.h"
+#include "DiscIO/DiscUtils.h"
+#include "DiscIO/Enums.h"
+#include "DiscIO/Volume.h"
+#include "DiscIO/VolumeVerifier.h"
+#include "DiscIO/VolumeWii.h"
+
+namespace
+{
+constexpr DiscIO::Partition DATA_PARTITION(0x50000);
+constexpr u64 PARTITION_DATA_OFFSET = 0x20000;
+constexpr u64 GROUPS = 3;
+constexpr u64 DATA_START = DATA_PARTITION.offset + PARTITION_DATA_OFFSET;
+constexpr u64 DATA_SIZE = GROUPS * DiscIO::VolumeWii::GROUP_TOTAL_SIZE;
+
+// A Wii disc with a single partition that has valid hashes everywhere except in one block of the
+// second group, and where the third group can't be read
+class FakeWiiVolume final : public DiscIO::Volume
+{
+public:
+  static constexpr u64 CORRUPT_BLOCK = DiscIO::VolumeWii::BLOCKS_PER_GROUP + 6;
+  static constexpr u64 UNREADABLE_START = DATA_START + 2 * DiscIO::VolumeWii::GROUP_TOTAL_SIZE;
+
+  bool Read(u64 offset, u64 length, u8* buffer, const DiscIO::Partition& partition) const override
+  {
+    if (partition == DATA_PARTITION)
+    {
+      if (offset != 0 || length > 0x80)
+        return false;
+
+      std::memset(buffer, 0, length);
+      const u32 magic = Common::swap32(DiscIO::WII_DISC_MAGIC);
+      std::memcpy(buffer + 0x18, &magic, sizeof(magic));
+      return true;
+    }
+
+    if (partition != DiscIO::PARTITION_NONE || offset + length > UNREADABLE_START)
+      return false;
+
+    std::memset(buffer, 0, length);
+    const u64 data_size_offset = DATA_PARTITION.offset + 0x2bc;
+    if (offset <= data_size_offset && offset + length >= data_size_offset + sizeof(u32))
+    {
+      const u32 data_size = Common::swap32(static_cast<u32>(DATA_SIZE));
+      std::memcpy(buffer + (data_size_offset - offset), &data_size, sizeof(data_size));
+    }
+    return true;
+  }
+
+  bool HasWiiHashes() const override { return true; }
+  bool HasWiiEncryption() const override { return true; }
+  std::vector<DiscIO::Partition> GetPartitions() const override { return {DATA_PARTITION}; }
+  DiscIO::Partition GetGamePartition() const override { return DATA_PARTITION; }
+  std::optional<u32> GetPartitionType(const DiscIO::Partition& partition) const override
+  {
+    return DiscIO::PARTITION_DATA;
+  }
+  const DiscIO::FileSystem* GetFileSystem(const DiscIO::Partition& partition) const override
+  {
+    return nullptr;
+  }
+  u64 PartitionOffsetToRawOffset(u64 offset, const DiscIO::Partition& partition) const override
+  {
+    return partition.offset + PARTITION_DATA_OFFSET + offset;
+  }
+  std::string GetGameID(const DiscIO::Partition& partition) const override { return "RABAZZ"; }
+  std::string GetGameTDBID(const DiscIO::Partition& partition) const override { return "RABAZZ"; }
+  std::string GetMakerID(const DiscIO::Partition& partition) const override { return "ZZ"; }
+  std::optional<u16> GetRevision(const DiscIO::Partition& partition) const override { return 0; }
+  std::string GetInternalName(const DiscIO::Partition& partition) const override { return {}; }
+  std::vector<u32> GetBanner(u32* width, u32* height) const override { return {}; }
+  std::string GetApploaderDate(const DiscIO::Partition& partition) const override { return {}; }
+  DiscIO::Platform GetVolumeType() const override { return DiscIO::Platform::WiiDisc; }
+  // Skips the signature and file system checks, which this volume has no data for
+  bool IsDatelDisc() const override { return true; }
+  bool IsNKit() const override { return false; }
+  bool CheckH3TableIntegrity(const DiscIO::Partition& partition) const override { return true; }
+  bool CheckBlockIntegrity(u64 block_index, const u8* encrypted_data,
+                           const DiscIO::Partition& partition) const override
+  {
+    return block_index != CORRUPT_BLOCK;
+  }
+  DiscIO::Region GetRegion() const override { return DiscIO::Region::NTSC_U; }
+  DiscIO::Country GetCountry(const DiscIO::Partition& partition) const override
+  {
+    return DiscIO::Country::USA;
+  }
+  DiscIO::BlobType GetBlobType() const override { return DiscIO::BlobType::PLAIN; }
+  u64 GetDataSize() const override { return DATA_START + DATA_SIZE; }
+  DiscIO::DataSizeType GetDataSizeType() const override { return DiscIO::DataSizeType::Accurate; }
+  u64 GetRawSize() const override { return GetDataSize(); }
+  // Not used by VolumeVerifier
+  const DiscIO::BlobReader& GetBlobReader() const override { std::abort(); }
+  std::array<u8, 20> GetSyncHash() const override { return {}; }
+};
+}  // namespace
+
+TEST(VolumeVerifier, ReadFailureKeepsResultsOfPreviousGroup)
+{
+  const FakeWiiVolume volume;
+  DiscIO::VolumeVerifier verifier(volume, false, {});
+  verifier.Start();
+  while (verifier.GetBytesProcessed() != verifier.GetTotalBytes())
+    verifier.Process();
+  verifier.Finish();
+
+  const DiscIO::VolumeVerifier::Result& result = verifier.GetResult();
+  const auto has_problem = [&result](const std::string& text) {
+    return std::ranges::any_of(result.problems, [&text](const auto& problem) {
+      return problem.text.find(text) != std::string::npos;
+    });
+  };
+
+  EXPECT_TRUE(has_problem("Some of the data could not be read."));
+  // The unreadable group counts as corrupt, and the corrupt block in the group that was being
+  // verified when the read failed must not be lost
+  EXPECT_TRUE(has_problem(fmt::format("Errors were found in {} blocks",
+                                      DiscIO::VolumeWii::BLOCKS_PER_GROUP + 1)));
+}
@@ -0,0 +1,177 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "Common/CPUDetect.h"
+#include "Common/CommonTypes.h"
+#include "VideoCommon/TextureDecoder.h"
+
+namespace
+{
+constexpr std::array<TextureFormat, 11> TEXTURE_FORMATS = {
+    TextureFormat::I4,     TextureFormat::I8,     TextureFormat::IA4,   TextureFormat::IA8,
+    TextureFormat::RGB565, TextureFormat::RGB5A3, TextureFormat::RGBA8, TextureFormat::C4,
+    TextureFormat::C8,     TextureFormat::C14X2,  TextureFormat::CMPR,
+};
+
+constexpr std::array<TLUTFormat, 3> TLUT_FORMATS = {TLUTFormat::IA8, TLUTFormat::RGB565,
+                                                    TLUTFormat::RGB5A3};
+
+#ifdef _M_X86_64
+// Restores the detected CPU features when a test that disables some of them ends, including when
+// it ends early because an assertion failed.
+class ScopedCPUInfo
+{
+public:
+  ScopedCPUInfo() : m_original_cpu_info(cpu_info) {}
+  ~ScopedCPUInfo() { cpu_info = m_original_cpu_info; }
+
+  ScopedCPUInfo(const ScopedCPUInfo&) = delete;
+  ScopedCPUInfo& operator=(const ScopedCPUInfo&) = delete;
+
+private:
+  const CPUInfo m_original_cpu_info;
+};
+#endif
+
+bool IsPaletteFormat(TextureFormat format)
+{
+  return format == TextureFormat::C4 || format == TextureFormat::C8 ||
+         format == TextureFormat::C14X2;
+}
+
+// The block decoders, which have SIMD paths for some formats, must match the per-texel decoder.
+// The default size is wide enough for the SIMD loops to run more than once and to have leftover
+// blocks.
+void CheckAgainstTexelDecoder(int width = 72, int height = 24)
+{
+  std::mt19937 rng(0);
+  std::vector<u8> tlut(2 * 16384);
+  for (u8& byte : tlut)
+    byte = static_cast<u8>(rng());
+
+  for (const TextureFormat format : TEXTURE_FORMATS)
+  {
+    for (const TLUTFormat tlut_format : TLUT_FORMATS)
+    {
+      if (!IsPaletteFormat(format) && tlut_format != TLUT_FORMATS[0])
+        continue;
+
+      std::vector<u8> src(TexDecoder_GetTextureSizeInBytes(width, height, format));
+      for (u8& byte : src)
+        byte = static_cast<u8>(rng());
+
+      std::vector<u8> decoded(width * height * 4);
+      TexDecoder_Decode(decoded.data(), src.data(), width, height, format, tlut.data(),
+                        tlut_format);
+
+      for (int t = 0; t < height; ++t)
+      {
+        for (int s = 0; s < width; ++s)
+        {
+          // Like the texture registers, the texel decoder takes the width minus one
+          std::array<u8, 4> texel;
+          TexDecoder_DecodeTexel(texel.data(), src, s, t, width - 1, format, tlut, tlut_format);
+          const u8* decoded_texel = &decoded[(t * width + s) * 4];
+          ASSERT_TRUE(std::equal(texel.begin(), texel.end(), decoded_texel))
+              << "format " << static_cast<int>(format) << ", tlut format "
+              << static_cast<int>(tlut_format) << ", texel " << s << "," << t;
+        }
+      }
+    }
+  }
+}
+}  // namespace
+
+TEST(TextureDecoder, MatchesTexelDecoder)
+{
+  CheckAgainstTexelDecoder();
+}
+
+// Textures of at least 512x512 texels are split into strips that are decoded on several threads,
+// if the machine has more than one.
+TEST(TextureDecoder, MatchesTexelDecoderWhenDecodedInParallel)
+{
+  CheckAgainstTexelDecoder(512, 512);
+  CheckAgainstTexelDecoder(1024, 520);
+}
+
+#ifdef _M_X86_64
+TEST(TextureDecoder, MatchesTexelDecoderWithoutAVX2)
+{
+  const ScopedCPUInfo scoped_cpu_info;
+  cpu_info.bAVX2 = false;
+  CheckAgainstTexelDecoder();
+  cpu_info.bSSSE3 = false;
+  CheckAgainstTexelDecoder();
+}
+#endif
+
+// Not run by default. Run it with --gtest_also_run_disabled_tests --gtest_filter=*Benchmark to
+// print the decoding speed of every format, and to check that the SIMD paths give the same result
+// as the scalar ones.
+TEST(TextureDecoder, DISABLED_Benchmark)
+{
+  constexpr int width = 1024;
+  constexpr int height = 1024;
+  constexpr int iterations = 50;
+
+  std::mt19937 rng(0);
+  std::vector<u8> tlut(2 * 16384);
+  for (u8& byte : tlut)
+    byte = static_cast<u8>(rng());
+
+  const auto decode = [&](std::vector<u8>* decoded, const std::vector<u8>& src,
+                          TextureFormat format, TLUTFormat tlut_format) {
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i)
+    {
+      TexDecoder_Decode(decoded->data(), src.data(), width, height, format, tlut.data(),
+                        tlut_format);
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return static_cast<double>(src.size()) * iterations / elapsed.count() / (1024 * 1024);
+  };
+
+  for (const TextureFormat format : TEXTURE_FORMATS)
+  {
+    for (const TLUTFormat tlut_format : TLUT_FORMATS)
+    {
+      if (!IsPaletteFormat(format) && tlut_format != TLUT_FORMATS[0])
+        continue;
+
+      std::vector<u8> src(TexDecoder_GetTextureSizeInBytes(width, height, format));
+      for (u8& byte : src)
+        byte = static_cast<u8>(rng());
+
+      std::vector<u8> decoded(width * height * 4);
+      const double speed = decode(&decoded, src, format, tlut_format);
+
+#ifdef _M_X86_64
+      std::vector<u8> scalar_decoded(width * height * 4);
+      double scalar_speed;
+      {
+        const ScopedCPUInfo scoped_cpu_info;
+        cpu_info.bAVX2 = false;
+        cpu_info.bSSSE3 = false;
+        scalar_speed = decode(&scalar_decoded, src, format, tlut_format);
+      }
+      EXPECT_EQ(decoded, scalar_decoded) << "format " << static_cast<int>(format)
+                                         << ", tlut format " << static_cast<int>(tlut_format);
+      fmt::print("format {:2} tlut {}: {:8.1f} MB/s, {:8.1f} MB/s scalar\n",
+                 static_cast<int>(format), static_cast<int>(tlut_format), speed, scalar_speed);
+#else
+      fmt::print("format {:2} tlut {}: {:8.1f} MB/s\n", static_cast<int>(format),
+                 static_cast<int>(tlut_format), speed);
+#endif
+    }
+  }
+}